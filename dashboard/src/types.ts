@@ -5,14 +5,24 @@ export interface PunchEvent {
   type: string       // "straight" | "hook" | "uppercut" | "unknown"
   force: number      // m/s²
   rotation_z: number // peak °/s
-  ts: number         // ESP32 millis
+  ts: number         // server clock, ms since the epoch (both hands on one timeline)
   count: number      // punch number in session
+  features?: PunchFeatures  // only from gloves reporting them (event-only mode)
+}
+
+// Measured on the glove over the full-rate samples around one punch
+export interface PunchFeatures {
+  impulse: number                       // m/s, |linear accel| over the impact
+  duration_ms: number                   // impact duration
+  retraction_ms: number                 // peak to pull-back
+  peak_gyro: [number, number, number]   // signed peak °/s per sensor axis
 }
 
 export interface HandState {
   connected: boolean
   calibrated: boolean
   battery: number
+  idle: boolean                            // glove streaming its idle rate tier
   packet_loss: number
   punch_count: number
   punch_breakdown: Record<string, number>
@@ -22,6 +32,7 @@ export interface HandState {
   recent_punches: PunchEvent[]
   current_accel: [number, number, number]  // X, Y, Z in m/s²
   current_gyro: [number, number, number]   // X, Y, Z in °/s
+  current_quat: [number, number, number, number]  // W, X, Y, Z, sensor → world (fused stream only)
   // Calibration state
   calibration_progress: number             // 0.0 to 1.0
   gravity_ref: [number, number, number]    // Gravity vector in sensor frame
@@ -31,6 +42,8 @@ export interface HandState {
 
 export interface CombinedStats {
   total_punches: number
+  combos: number           // runs of 2+ punches in quick succession, across hands
+  max_combo: number        // longest such run
   avg_force: number
   max_force: number
   ppm: number
@@ -61,6 +74,7 @@ export const defaultHandState: HandState = {
   connected: false,
   calibrated: false,
   battery: 0,
+  idle: false,
   packet_loss: 0,
   punch_count: 0,
   punch_breakdown: {},
@@ -70,6 +84,7 @@ export const defaultHandState: HandState = {
   recent_punches: [],
   current_accel: [0, 0, 0],
   current_gyro: [0, 0, 0],
+  current_quat: [0, 0, 0, 0],
   calibration_progress: 0,
   gravity_ref: [0, 0, 0],
   glove_orientation: '',
@@ -81,7 +96,7 @@ export const defaultSession: SessionState = {
   elapsed_sec: 0,
   left: { ...defaultHandState },
   right: { ...defaultHandState },
-  combined: { total_punches: 0, avg_force: 0, max_force: 0, ppm: 0, pps: 0, intensity_score: 0 },
+  combined: { total_punches: 0, combos: 0, max_combo: 0, avg_force: 0, max_force: 0, ppm: 0, pps: 0, intensity_score: 0 },
   paused: false,
 }
 
@@ -0,0 +1,389 @@
+/**
+ * FighterLink Trace-Replay Benchmark
+ *
+ * Runs recorded glove traces through the firmware's portable signal
+ * pipeline on the host: fixed-point scaling, orientation fusion, frame
+ * building, stillness / gravity capture, punch detection and per-punch
+ * feature extraction. Reports per-stage throughput and
+ * per-sample pipeline latency, and checks each trace's punch count against
+ * the server's (expected.txt, written by server/cmd/tracecount). Before the
+ * traces it checks that UsbFrameReader resyncs after false syncs and bad
+ * frames in the status text.
+ *
+ * Traces are the server's CSV recordings (TRACE_DIR) in packet units. The
+ * scaling and fusion stages run on LSB reconstructed from them for the
+ * trace's rate profile; detection runs on the recorded values, as the
+ * server does.
+ *
+ * Build and run (native env, see platformio.ini):
+ *   pio run -e native && .pio/build/native/program bench/traces
+ *
+ * Exits non-zero if any trace's punch count differs from expected.txt or
+ * the USB framing check fails.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "config.h"
+#include "imu_sample.h"
+#include "orientation_filter.h"
+#include "punch_detector.h"
+#include "punch_features.h"
+#include "rate_profile.h"
+#include "sample_batcher.h"
+#include "sample_scale.h"
+#include "stillness.h"
+#include "usb_frame.h"
+
+namespace fs = std::filesystem;
+using Clock = std::chrono::steady_clock;
+
+#define BENCH_RUNS      5       // Best-of-N passes per stage
+#define BENCH_MTU       247     // Frames built delta-encoded at this ATT MTU
+
+struct TraceSample {
+    uint32_t timestamp;         // µs since the first sample
+    SampleRecord record;        // Packet units
+};
+
+// ─── Trace Loading ───────────────────────────────────────────────────────────
+static bool loadTrace(const fs::path& path, std::vector<TraceSample>& out) {
+    std::ifstream in(path);
+    std::string line;
+    if (!std::getline(in, line)) return false;     // Header
+
+    while (std::getline(in, line)) {
+        if (line.empty()) continue;
+        long long ts;
+        int v[6];
+        if (sscanf(line.c_str(), "%lld,%d,%d,%d,%d,%d,%d",
+                   &ts, &v[0], &v[1], &v[2], &v[3], &v[4], &v[5]) != 7) {
+            fprintf(stderr, "%s: bad line: %s\n", path.c_str(), line.c_str());
+            return false;
+        }
+        TraceSample s;
+        s.timestamp = (uint32_t)ts;
+        s.record = {(int16_t)v[0], (int16_t)v[1], (int16_t)v[2],
+                    (int16_t)v[3], (int16_t)v[4], (int16_t)v[5]};
+        out.push_back(s);
+    }
+    return true;
+}
+
+// "<name> <count>" per line
+static std::map<std::string, int> loadExpected(const fs::path& path) {
+    std::map<std::string, int> expected;
+    std::ifstream in(path);
+    std::string name;
+    int count;
+    while (in >> name >> count) {
+        expected[name] = count;
+    }
+    return expected;
+}
+
+// Profile whose nominal spacing is closest to the trace's mean spacing
+static uint8_t traceProfile(const std::vector<TraceSample>& trace) {
+    if (trace.size() < 2) return RATE_PROFILE_100HZ;
+    uint32_t meanUs = (trace.back().timestamp - trace.front().timestamp) / (trace.size() - 1);
+
+    uint8_t best = RATE_PROFILE_100HZ;
+    uint32_t bestDiff = UINT32_MAX;
+    for (uint8_t id = 0; id < RATE_PROFILE_COUNT; id++) {
+        uint32_t periodUs = rateProfile(id).periodUs;
+        uint32_t diff = periodUs > meanUs ? periodUs - meanUs : meanUs - periodUs;
+        if (diff < bestDiff) {
+            best = id;
+            bestDiff = diff;
+        }
+    }
+    return best;
+}
+
+// Packet units → raw LSB, inverse of the profile's scaling
+static ImuRawSample toLsb(const SampleRecord& r, const RateProfile& profile) {
+    const float accel = ACCEL_LSB_PER_G[profile.accelRange] / (GRAVITY_MS2 * ACCEL_SCALE);
+    const float gyro = GYRO_LSB_PER_DPS[profile.gyroRange] / GYRO_SCALE;
+    auto clamp = [](float v) {
+        return (int16_t)std::min(32767.0f, std::max(-32768.0f, v < 0 ? v - 0.5f : v + 0.5f));
+    };
+    return {clamp(r.accX * accel), clamp(r.accY * accel), clamp(r.accZ * accel),
+            clamp(r.gyroX * gyro), clamp(r.gyroY * gyro), clamp(r.gyroZ * gyro)};
+}
+
+// ─── Pipeline Stages ─────────────────────────────────────────────────────────
+// Each returns something derived from every sample so the work isn't elided
+static uint32_t runScale(const std::vector<ImuRawSample>& lsb, const RateProfile& profile) {
+    uint32_t sum = 0;
+    for (const ImuRawSample& s : lsb) {
+        SampleRecord r = scaleSample(s, profile.accelRange, profile.gyroRange);
+        sum += (uint16_t)(r.accX ^ r.accY ^ r.accZ ^ r.gyroX ^ r.gyroY ^ r.gyroZ);
+    }
+    return sum;
+}
+
+static uint32_t runFuse(const std::vector<ImuRawSample>& lsb,
+                        const std::vector<TraceSample>& trace, const RateProfile& profile) {
+    OrientationFilter fusion;
+    fusion.configure(profile.accelRange, profile.gyroRange, profile.periodUs);
+    uint32_t sum = 0;
+    for (size_t i = 0; i < lsb.size(); i++) {
+        fusion.update(lsb[i]);
+        FusionRecord f = fusion.output(trace[i].record);
+        sum += (uint16_t)(f.quatW ^ f.quatX ^ f.linAccX ^ f.linAccY ^ f.linAccZ);
+    }
+    return sum;
+}
+
+static uint32_t runBuild(const std::vector<TraceSample>& trace, const RateProfile& profile) {
+    SampleBatcher batcher(profile.periodUs, ENCODING_DELTA);
+    batcher.setMtu(BENCH_MTU);
+
+    uint32_t bytes = 0;
+    uint32_t sequence = 0;
+    for (const TraceSample& s : trace) {
+        if (!batcher.empty() && (batcher.full() || !batcher.continues(s.timestamp))) {
+            bytes += batcher.finish(100, 0);
+            batcher.clear();
+        }
+        batcher.append(s.record, s.timestamp, sequence++);
+    }
+    if (!batcher.empty()) {
+        bytes += batcher.finish(100, 0);
+    }
+    return bytes;
+}
+
+// Mirrors the server Analyzer: no detection until gravity is captured, and
+// the capturing sample itself is not checked. Every checked sample also
+// goes through the feature window, against the static gravity reference.
+class Detection {
+public:
+    void update(const TraceSample& s) {
+        if (_gravity.update(s.record, s.timestamp)) {
+            const float* g = _gravity.gravity();
+            _detector.setGravity(g[0], g[1], g[2]);
+            return;
+        }
+        if (!_gravity.done()) return;
+
+        const SampleRecord& r = s.record;
+        _detector.update((float)r.accX / ACCEL_SCALE, (float)r.accY / ACCEL_SCALE,
+                         (float)r.accZ / ACCEL_SCALE, (float)r.gyroX / GYRO_SCALE,
+                         (float)r.gyroY / GYRO_SCALE, (float)r.gyroZ / GYRO_SCALE, s.timestamp);
+
+        const float* g = _detector.gravity();
+        const int16_t linAcc[3] = {(int16_t)(r.accX - lroundf(g[0] * ACCEL_SCALE)),
+                                   (int16_t)(r.accY - lroundf(g[1] * ACCEL_SCALE)),
+                                   (int16_t)(r.accZ - lroundf(g[2] * ACCEL_SCALE))};
+        const int16_t gyro[3] = {r.gyroX, r.gyroY, r.gyroZ};
+        if (_window.add(linAcc, gyro, s.timestamp)) {
+            const PunchFeatures& f = _window.features();
+            _featured++;
+            _impulse += f.impulse;
+            _durationMs += f.durationUs / 1e3;
+            _retractionMs += f.retractionUs / 1e3;
+        }
+        if (_detector.triggered()) {
+            _window.trigger(_detector.count(), _detector.upAxis());
+        }
+    }
+
+    bool calibrated() const { return _gravity.done(); }
+    int punches() const { return _detector.count(); }
+
+    // Punches whose feature window closed, and their feature means
+    int featured() const { return _featured; }
+    double meanImpulse() const { return _featured ? _impulse / _featured : 0; }
+    double meanDurationMs() const { return _featured ? _durationMs / _featured : 0; }
+    double meanRetractionMs() const { return _featured ? _retractionMs / _featured : 0; }
+
+private:
+    GravityCapture _gravity;
+    PunchDetector _detector;
+    PunchWindow _window;
+    int _featured = 0;
+    double _impulse = 0;
+    double _durationMs = 0;
+    double _retractionMs = 0;
+};
+
+static uint32_t runDetect(const std::vector<TraceSample>& trace) {
+    Detection detection;
+    for (const TraceSample& s : trace) {
+        detection.update(s);
+    }
+    return detection.punches();
+}
+
+// Best-of-N wall time of one pass, ns per sample
+template <typename Stage>
+static double nsPerSample(size_t samples, Stage stage) {
+    double best = 1e30;
+    volatile uint32_t sink = 0;
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        Clock::time_point start = Clock::now();
+        sink = sink + stage();
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        best = std::min(best, ns / samples);
+    }
+    return best;
+}
+
+// ─── Replay ──────────────────────────────────────────────────────────────────
+struct TraceResult {
+    int punches;
+    bool calibrated;
+};
+
+static TraceResult replay(const std::string& name, const std::vector<TraceSample>& trace) {
+    const uint8_t profileId = traceProfile(trace);
+    const RateProfile& profile = rateProfile(profileId);
+
+    std::vector<ImuRawSample> lsb;
+    lsb.reserve(trace.size());
+    for (const TraceSample& s : trace) {
+        lsb.push_back(toLsb(s.record, profile));
+    }
+
+    double scaleNs = nsPerSample(trace.size(), [&] { return runScale(lsb, profile); });
+    double fuseNs = nsPerSample(trace.size(), [&] { return runFuse(lsb, trace, profile); });
+    double buildNs = nsPerSample(trace.size(), [&] { return runBuild(trace, profile); });
+    double detectNs = nsPerSample(trace.size(), [&] { return runDetect(trace); });
+
+    // Whole pipeline, one sample at a time, for the latency distribution
+    std::vector<double> latency;
+    latency.reserve(trace.size());
+    SampleBatcher batcher(profile.periodUs, ENCODING_DELTA);
+    batcher.setMtu(BENCH_MTU);
+    OrientationFilter fusion;
+    fusion.configure(profile.accelRange, profile.gyroRange, profile.periodUs);
+    Detection detection;
+    volatile uint32_t sink = 0;
+    for (size_t i = 0; i < trace.size(); i++) {
+        Clock::time_point start = Clock::now();
+        SampleRecord r = scaleSample(lsb[i], profile.accelRange, profile.gyroRange);
+        fusion.update(lsb[i]);
+        sink = sink + fusion.output(r).linAccZ;
+        if (!batcher.empty() && (batcher.full() || !batcher.continues(trace[i].timestamp))) {
+            sink = sink + batcher.finish(100, 0);
+            batcher.clear();
+        }
+        batcher.append(r, trace[i].timestamp, (uint32_t)i);
+        detection.update(trace[i]);
+        latency.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+    }
+    std::sort(latency.begin(), latency.end());
+    double mean = 0;
+    for (double ns : latency) mean += ns;
+    mean /= latency.size();
+    double p99 = latency[std::min(latency.size() - 1, latency.size() * 99 / 100)];
+
+    double seconds = (trace.back().timestamp - trace.front().timestamp) / 1e6;
+    printf("%s: %zu samples, %.1fs at %uHz\n", name.c_str(), trace.size(), seconds,
+           profile.rateHz);
+    printf("  stage ns/sample   scale %.1f   fuse %.1f   build %.1f   detect %.1f\n", scaleNs,
+           fuseNs, buildNs, detectNs);
+    double totalNs = scaleNs + fuseNs + buildNs + detectNs;
+    printf("  throughput        %.2f M samples/s (%.0fx the %uHz budget)\n", 1e3 / totalNs,
+           1e9 / profile.rateHz / totalNs, profile.rateHz);
+    printf("  latency ns        mean %.1f   p99 %.1f   max %.1f\n", mean, p99, latency.back());
+    printf("  features          %d punches   impulse %.2f m/s   impact %.1f ms   retraction %.1f ms\n",
+           detection.featured(), detection.meanImpulse(), detection.meanDurationMs(),
+           detection.meanRetractionMs());
+
+    return {detection.punches(), detection.calibrated()};
+}
+
+// A false sync with a bogus length in the status text right before a real
+// frame, then a bad length and a bad CRC: every real frame and no other
+// must come out.
+static bool checkUsbFraming() {
+    static const uint8_t payload[] = {0xB1, 0x01, 0x02};
+    uint8_t frame[USB_FRAME_MAX_BYTES];
+    size_t frameLength = usbFrameEncode(1, payload, sizeof(payload), frame);
+
+    std::vector<uint8_t> stream;
+    auto text = [&](const char* line) { stream.insert(stream.end(), line, line + strlen(line)); };
+    auto bytes = [&](std::initializer_list<uint8_t> b) { stream.insert(stream.end(), b); };
+    auto real = [&]() { stream.insert(stream.end(), frame, frame + frameLength); };
+
+    text("Boot\n");
+    bytes({USB_FRAME_SYNC0, USB_FRAME_SYNC1, 0, 12, 0});   // Claims the real frame and more
+    real();
+    text("Status\n");
+    bytes({USB_FRAME_SYNC0, USB_FRAME_SYNC1, 0, 0xFF, 0xFF});
+    real();
+    real();
+    stream.back() ^= 0xFF;                                  // Bad CRC
+    real();
+
+    UsbFrameReader reader;
+    int frames = 0;
+    bool intact = true;
+    for (uint8_t byte : stream) {
+        if (!reader.feed(byte)) continue;
+        frames++;
+        intact = intact && reader.length() == sizeof(payload) &&
+                 memcmp(reader.data(), payload, sizeof(payload)) == 0;
+    }
+    bool ok = frames == 3 && intact && reader.rejected() == 3;
+    printf("usb framing: %d frames, %u rejected %s\n", frames, (unsigned)reader.rejected(),
+           ok ? "OK" : "FAILED (want 3, 3)");
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    fs::path dir = argc > 1 ? argv[1] : "bench/traces";
+    if (!fs::is_directory(dir)) {
+        fprintf(stderr, "usage: %s [trace directory]\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<fs::path> traces;
+    for (const fs::directory_entry& entry : fs::directory_iterator(dir)) {
+        if (entry.path().extension() == ".csv") traces.push_back(entry.path());
+    }
+    std::sort(traces.begin(), traces.end());
+    if (traces.empty()) {
+        fprintf(stderr, "%s: no traces\n", dir.c_str());
+        return 2;
+    }
+
+    std::map<std::string, int> expected = loadExpected(dir / "expected.txt");
+    int mismatches = checkUsbFraming() ? 0 : 1;
+    for (const fs::path& path : traces) {
+        std::vector<TraceSample> trace;
+        if (!loadTrace(path, trace) || trace.empty()) {
+            fprintf(stderr, "%s: unreadable or empty\n", path.c_str());
+            mismatches++;
+            continue;
+        }
+
+        std::string name = path.filename().string();
+        TraceResult result = replay(name, trace);
+
+        auto it = expected.find(name);
+        if (it == expected.end()) {
+            printf("  punches           %d%s (no expected count)\n", result.punches,
+                   result.calibrated ? "" : ", never calibrated");
+        } else if (it->second == result.punches) {
+            printf("  punches           %d OK\n", result.punches);
+        } else {
+            printf("  punches           %d MISMATCH (server %d)\n", result.punches, it->second);
+            mismatches++;
+        }
+    }
+    return mismatches ? 1 : 0;
+}
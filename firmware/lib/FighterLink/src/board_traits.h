@@ -0,0 +1,65 @@
+/**
+ * FighterLink Board Traits
+ *
+ * Everything that differs between the supported boards, as constexpr members
+ * of one traits type per board. Board is picked from the IDF target at
+ * compile time, so the firmware branches on it with `if constexpr` and
+ * static_assert: each build carries only its own board's path.
+ *
+ * Both boards are wired the same way to the MPU6050 (SDA, SCL, INT); only the
+ * pin numbers differ.
+ */
+
+#ifndef BOARD_TRAITS_H
+#define BOARD_TRAITS_H
+
+#include <stdint.h>
+#include <sdkconfig.h>
+
+// if constexpr here and the constexpr loops in sample_scale.h: arduino-esp32
+// 2.x defaults to gnu++11 (platformio.ini unflags it; the IDE cannot)
+#if __cplusplus < 201703L
+#error "FighterLink needs C++17: arduino-esp32 3.x or later, or -std=gnu++17"
+#endif
+
+// Seeed Studio XIAO ESP32C3: one RISC-V core without FPU, battery divider and
+// pogo-pin charge sense on the glove board
+struct XiaoEsp32C3 {
+    static constexpr const char* name = "XIAO ESP32C3";
+    static constexpr uint8_t pinSda = 6;
+    static constexpr uint8_t pinScl = 7;
+    static constexpr uint8_t pinImuInt = 4;         // D2; deep-sleep wake capable
+    static constexpr uint8_t pinLed = 10;
+    static constexpr bool ledActiveLow = true;
+    static constexpr uint8_t cores = 1;
+    static constexpr bool hasFpu = false;
+    static constexpr bool hasPowerSense = true;     // pinVbat / pinVcharge wired
+    static constexpr uint8_t pinVbat = 2;
+    static constexpr uint8_t pinVcharge = 3;
+};
+
+// ESP32 DevKit (Arduino IDE prototype): dual Xtensa cores with FPU, powered
+// over USB with no battery sense
+struct Esp32DevKit {
+    static constexpr const char* name = "ESP32 DevKit";
+    static constexpr uint8_t pinSda = 21;
+    static constexpr uint8_t pinScl = 22;
+    static constexpr uint8_t pinImuInt = 4;         // RTC GPIO, ext0 wake capable
+    static constexpr uint8_t pinLed = 2;
+    static constexpr bool ledActiveLow = false;
+    static constexpr uint8_t cores = 2;
+    static constexpr bool hasFpu = true;
+    static constexpr bool hasPowerSense = false;
+    static constexpr uint8_t pinVbat = 0;           // Unused without power sense
+    static constexpr uint8_t pinVcharge = 0;
+};
+
+#if CONFIG_IDF_TARGET_ESP32C3
+using Board = XiaoEsp32C3;
+#elif CONFIG_IDF_TARGET_ESP32
+using Board = Esp32DevKit;
+#else
+#error "FighterLink: no board traits for this target (see board_traits.h)"
+#endif
+
+#endif // BOARD_TRAITS_H
@@ -0,0 +1,44 @@
+/**
+ * FighterLink Clock Sync
+ *
+ * Every timestamp the glove sends is its esp_timer clock in µs, truncated
+ * to 32 bits (wraps every ~71.6 minutes; receivers unwrap). Each glove runs
+ * its own crystal, so the central estimates offset and drift per glove with
+ * an NTP-style ping/echo on the sync characteristic:
+ *
+ *   central  t0 ── ping(token) ──▶ t1  glove
+ *   central  t3 ◀── echo ───────── t2  glove
+ *
+ *   offset = ((t1 - t0) + (t2 - t3)) / 2      (glove clock - central clock)
+ *   delay  = (t3 - t0) - (t2 - t1)
+ *
+ * t1 is taken in the write callback and t2 just before the echo is notified,
+ * so however long the echo waits for the sender does not bias the offset.
+ *
+ * Ping (write, 4 bytes): token, echoed back unchanged.
+ *
+ * Echo (notify, 12 bytes):
+ *
+ * Field   | Offset | Size | Type   | Units
+ * --------|--------|------|--------|---------------------------
+ * token   | 0      | 4    | uint32 | from the ping
+ * rxTime  | 4      | 4    | uint32 | µs, ping received (t1)
+ * txTime  | 8      | 4    | uint32 | µs, echo sent (t2)
+ */
+
+#ifndef CLOCK_SYNC_H
+#define CLOCK_SYNC_H
+
+#include <stdint.h>
+
+#define SYNC_PING_SIZE          4
+
+struct __attribute__((packed)) SyncEcho {
+    uint32_t token;
+    uint32_t rxTime;
+    uint32_t txTime;
+};
+
+static_assert(sizeof(SyncEcho) == 12, "SyncEcho must be exactly 12 bytes");
+
+#endif // CLOCK_SYNC_H
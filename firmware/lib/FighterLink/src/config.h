@@ -0,0 +1,347 @@
+/**
+ * FighterLink Configuration
+ * 
+ * BLE UUIDs, Pin Definitions, and Constants
+ */
+
+#ifndef CONFIG_H
+#define CONFIG_H
+
+// ─── BLE Configuration ───────────────────────────────────────────────────────
+// Custom UUIDs for FighterLink service and characteristics
+#define BLE_SERVICE_UUID        "00001234-0000-1000-8000-00805f9b34fb"
+#define BLE_CHAR_SENSOR_UUID    "00001235-0000-1000-8000-00805f9b34fb"  // NOTIFY
+#define BLE_CHAR_BATTERY_UUID   "00001236-0000-1000-8000-00805f9b34fb"  // READ, NOTIFY
+#define BLE_CHAR_DEVICE_UUID    "00001237-0000-1000-8000-00805f9b34fb"  // READ (hand ID)
+#define BLE_CHAR_CONTROL_UUID   "00001238-0000-1000-8000-00805f9b34fb"  // READ, WRITE, NOTIFY (stream_control.h)
+#define BLE_CHAR_STATUS_UUID    "00001239-0000-1000-8000-00805f9b34fb"  // READ, NOTIFY (link_status.h)
+#define BLE_CHAR_SYNC_UUID      "0000123a-0000-1000-8000-00805f9b34fb"  // WRITE, NOTIFY (clock_sync.h)
+#define BLE_CHAR_BULK_UUID      "0000123b-0000-1000-8000-00805f9b34fb"  // NOTIFY (sample_log.h backfill)
+#define BLE_CHAR_DIAG_UUID      "0000123c-0000-1000-8000-00805f9b34fb"  // READ, NOTIFY (diagnostics.h)
+
+// Device names by hand (the hand is set in src/main.cpp or the sketch)
+#define BLE_DEVICE_NAME_LEFT    "FighterLink_L"
+#define BLE_DEVICE_NAME_RIGHT   "FighterLink_R"
+
+// GATT handles reserved for the service: 1 + 2 per characteristic + 1 per CCCD
+#define BLE_SERVICE_HANDLES     32
+
+// ATT MTU we offer; the central's MTU exchange decides what is actually used.
+// 247 + 4-byte L2CAP header = 251, so a full notification is one LL packet
+// once Data Length Extension is granted.
+#define BLE_LOCAL_MTU           247
+#define BLE_DEFAULT_MTU         23      // ATT minimum before any exchange
+
+// Link parameters requested once a central connects. The central may grant
+// something else; the status characteristic reports what is in effect.
+#define BLE_CONN_INTERVAL_MIN   6       // 1.25ms units: 7.5ms
+#define BLE_CONN_INTERVAL_MAX   6
+#define BLE_CONN_LATENCY        0       // Connection events the glove may skip
+#define BLE_CONN_TIMEOUT        200     // 10ms units: 2s supervision timeout
+#define BLE_DATA_LENGTH         251     // LL payload octets (DLE maximum)
+#define BLE_PREFER_2M_PHY       1       // BLE 5 targets only (ESP32-C3)
+
+// Host stack. Bluedroid is the core's BLE library; its setValue() copies
+// every notification into a heap std::string. NimBLE (NimBLE-Arduino 1.4,
+// pio run -e nimble) notifies straight from the frame buffer into mbufs
+// preallocated at init, and the stack itself takes less heap. Same
+// service, characteristics and UUIDs either way; no broadcast mode on
+// NimBLE.
+#define BLE_STACK_BLUEDROID     0
+#define BLE_STACK_NIMBLE        1
+#ifndef BLE_STACK
+#define BLE_STACK               BLE_STACK_BLUEDROID     // Build flag
+#endif
+
+// ─── Broadcast ───────────────────────────────────────────────────────────────
+// Connectionless mode for many gloves per receiver: instead of advertising
+// for a central, the glove puts every sensor-characteristic frame (batch,
+// single packet, punch event or heartbeat) into non-connectable BLE 5
+// extended advertising, behind a BroadcastHeader (sensor_packet.h) naming
+// the athlete and hand. No control, sync, resend or backfill; the stream
+// runs in its boot configuration and samples are placed by arrival time.
+// The controller repeats the newest frame every BROADCAST_INTERVAL_MS, so
+// frames have to come no faster than that: at 100Hz every mode qualifies,
+// above it use delta encoding or events. Each advertising event is about
+// 1.5ms of air whatever the payload, ~7% per glove at 20ms; for 15+ gloves
+// on one receiver stream events and raise the interval to 100ms (punches
+// are debounced further apart than that). Needs a BLE 5 chip (ESP32-C3)
+// and a BLE 5 receiver.
+#define BROADCAST_ENABLED       0
+#define BROADCAST_INTERVAL_MS   20      // Advertising interval (20ms minimum)
+#ifndef BROADCAST_ATHLETE_ID
+#define BROADCAST_ATHLETE_ID    0       // Shared by an athlete's two gloves (build flag)
+#endif
+#define BROADCAST_ADV_BYTES     251     // One-fragment extended advertising data
+
+// ─── USB Transport ───────────────────────────────────────────────────────────
+// Lab capture over the native USB CDC port (pio run -e usb_capture): every
+// sensor-characteristic frame goes to the host behind a UsbFrameHeader
+// (sensor_packet.h) instead of being notified, with batches at their full
+// BATCH_MAX_PAYLOAD. Status text keeps going to the same port between frames.
+// The host writes control values (rate, mode, format, latency) in the same
+// framing; no advertising, sync, resend or backfill, and no idle sleep. 1kHz
+// raw is ~13KB/s, far below USB full speed: frames are only lost when the
+// host stops reading and the TX buffer fills, and then whole (counted in
+// the diagnostics). Needs a native USB target (ESP32-C3) with
+// ARDUINO_USB_CDC_ON_BOOT.
+#ifndef USB_TRANSPORT_ENABLED
+#define USB_TRANSPORT_ENABLED   0       // Build flag
+#endif
+#define USB_TX_BUFFER_BYTES     4096    // ~300ms of 1kHz raw batches
+
+// ─── Sample Batching ─────────────────────────────────────────────────────────
+// Pack several samples into one notification (BatchHeader + SampleRecord[]),
+// sized to the negotiated MTU. With the default 23-byte MTU the firmware
+// falls back to one SensorPacket per sample.
+#define BATCH_ENABLED           1
+#define BATCH_MAX_LATENCY_MS    30      // Flush a partial batch after this long
+#define LEGACY_PACKET_MS        10      // Single packets are decimated to this spacing
+
+// Batch encoding: ENCODING_RAW (12 bytes/sample) or ENCODING_DELTA
+// (keyframe + zigzag varint deltas, ~6 bytes/sample while the glove is quiet)
+#define BATCH_ENCODING          ENCODING_DELTA
+
+// ─── Streaming Mode ──────────────────────────────────────────────────────────
+// STREAM_MODE_EVENTS: detect punches on the glove and notify only compact
+//                     PunchEventPackets (plus a heartbeat). Default.
+// STREAM_MODE_RAW:    stream every sample (batched/delta per the settings
+//                     above) for server-side analytics and calibration.
+// STREAM_MODE_SINGLE: stream every sample as its own SensorPacket, for
+//                     centrals that only parse the 20-byte format.
+// STREAM_MODE_FUSED:  as RAW, with each sample's orientation and linear
+//                     acceleration from the on-glove filter (needs
+//                     FUSION_ENABLED and an MTU that fits two records).
+// This is the boot default; the central can switch per session through the
+// control characteristic.
+#define STREAM_MODE_RAW         0
+#define STREAM_MODE_EVENTS      1
+#define STREAM_MODE_SINGLE      2
+#define STREAM_MODE_FUSED       3
+#define STREAM_MODE             STREAM_MODE_EVENTS
+#define EVENT_HEARTBEAT_MS      1000    // Heartbeat period in event mode
+
+// ─── I2C ─────────────────────────────────────────────────────────────────────
+// Pins, LED polarity and battery sense per board are in board_traits.h
+#define I2C_CLOCK_HZ    400000  // Fast-mode (MPU6050 max; 1MHz Fm+ is out of spec)
+
+// ─── Sample Rate ─────────────────────────────────────────────────────────────
+// RATE_PROFILE_100HZ | _200HZ | _500HZ | _1000HZ (see rate_profile.h). Each
+// profile sets ODR, DLPF and full-scale ranges together; profiles above
+// 100Hz need BATCH_ENABLED and IMU_FIFO_ENABLED. Boot default, like
+// STREAM_MODE.
+#define RATE_PROFILE            RATE_PROFILE_100HZ
+
+// ─── Timing Constants ────────────────────────────────────────────────────────
+#define BLE_NOTIFY_INTERVAL_MS  10      // Send BLE notification every 10ms
+#define BATTERY_UPDATE_MS       5000    // Update battery level every 5 seconds
+#define LED_BLINK_FAST_MS       200     // Fast blink period (advertising)
+#define LED_BLINK_SLOW_MS       1000    // Slow blink period (initializing)
+#define LED_TICK_MS             20      // LED pattern timer resolution (status_led.h)
+
+// ─── Sensor Scaling ──────────────────────────────────────────────────────────
+// MPU6050 outputs acceleration in g, we convert to m/s² and scale for int16
+// Accelerometer: value * 9.81 * 100 → int16 (divide by 100 on receiver)
+// Gyroscope: value * 10 → int16 (divide by 10 on receiver, units: °/s)
+#define ACCEL_SCALE     100     // m/s² * 100 → int16
+#define GYRO_SCALE      10      // °/s * 10 → int16
+#define GRAVITY_MS2     9.81f   // m/s²
+
+// ─── IMU FIFO Capture ────────────────────────────────────────────────────────
+// The MPU6050 samples at its own output data rate into its on-chip FIFO and
+// the firmware drains it in I2C bursts, so sample cadence does not depend on
+// loop() jitter. Set to 0 to fall back to one mpu.update() per loop tick.
+// Rate divider and DLPF come from RATE_PROFILE.
+#define IMU_FIFO_ENABLED        1
+#define IMU_FIFO_DRAIN_MS       10      // How often loop() drains the FIFO
+#define IMU_FIFO_MAX_DRAIN      32      // Max records handled per drain
+
+// ─── IMU Data-Ready Interrupt ────────────────────────────────────────────────
+// MPU6050 INT → Board::pinImuInt. The ISR timestamps each sample into a
+// lock-free ring and wakes loop(), which sleeps between samples instead of
+// polling millis(). Drained FIFO records are paired with those timestamps and
+// queued for the BLE sender. Requires IMU_FIFO_ENABLED.
+#define IMU_INTERRUPT_ENABLED   1
+#define IMU_STAMP_RING_SIZE     64      // ISR → acquisition (power of two)
+#define SAMPLE_RING_SIZE        128     // Acquisition → BLE sender (power of two)
+#define IMU_WAKE_TIMEOUT_MS     20      // loop() wakes at least this often
+
+#if IMU_INTERRUPT_ENABLED && !IMU_FIFO_ENABLED
+    #error "IMU_INTERRUPT_ENABLED requires IMU_FIFO_ENABLED"
+#endif
+
+// ─── Task Pipeline ───────────────────────────────────────────────────────────
+// Acquisition (FIFO drain, timestamping) and BLE transmission run as separate
+// FreeRTOS tasks joined by g_sampleRing; loop() keeps connection handling,
+// LED and battery. Dual-core targets pin the tasks to opposite cores; on the
+// single-core ESP32-C3 they are separated by priority only.
+#define PIPELINE_ENABLED        1
+#define ACQ_TASK_PRIORITY       10      // Above BLE task and loop() (1)
+#define ACQ_TASK_CORE           1       // APP core (dual-core only)
+#define ACQ_TASK_STACK          4096
+#define BLE_TASK_PRIORITY       5
+#define BLE_TASK_CORE           0       // The BLE host's core (dual-core only)
+#define BLE_TASK_STACK          4096
+#define BLE_TASK_WAKE_MS        10      // Max sleep between batch/heartbeat checks
+#define LOOP_IDLE_MS            10      // loop() housekeeping period
+
+#if PIPELINE_ENABLED && !IMU_FIFO_ENABLED
+    #error "PIPELINE_ENABLED requires IMU_FIFO_ENABLED"
+#endif
+
+// ─── Disconnect Log ──────────────────────────────────────────────────────────
+// When the link drops mid-session the glove keeps sampling into a flash ring
+// log (sample_log.h) and replays it on the bulk characteristic after the
+// central reconnects, alongside the live stream. At 100Hz the 1MB partition
+// holds about 25 minutes. Requires IMU_FIFO_ENABLED and the "samplelog"
+// partition from partitions.csv.
+#define SAMPLE_LOG_ENABLED      1
+#define SAMPLE_LOG_PARTITION    "samplelog"
+#define BACKFILL_BURST          3       // Frames notified per transmission wake
+
+#if SAMPLE_LOG_ENABLED && !IMU_FIFO_ENABLED
+    #error "SAMPLE_LOG_ENABLED requires IMU_FIFO_ENABLED"
+#endif
+
+// ─── Loss Recovery ───────────────────────────────────────────────────────────
+// The most recent sample frames stay in RAM (resend_buffer.h) so the central
+// can NACK a sequence gap on the control characteristic and have the frames
+// resent on the bulk characteristic. At the 30ms batch flush that is about
+// 7s of history at 100Hz and 2s at 1kHz.
+#define RESEND_ENABLED          1
+#define RESEND_BUFFER_BYTES     16384   // Frame bytes kept (power of two)
+#define RESEND_MAX_FRAMES       256     // Frames kept (power of two)
+#define RESEND_QUEUE_DEPTH      4       // NACKs waiting: BLE stack → sender
+#define RESEND_BURST            3       // Frames resent per transmission wake
+
+// ─── Sleep ───────────────────────────────────────────────────────────────────
+// The glove deep-sleeps with the MPU6050 motion-detect interrupt on
+// Board::pinImuInt as its wake source (accel-only cycling, ~70µA for the
+// sensor): in the charging case, after advertising this long without a
+// central, and when the sample stream shows no rotation for SLEEP_STILL_MS.
+// Waking is a boot that keeps its calibration in RTC memory and goes straight
+// back to advertising.
+#define SLEEP_ENABLED           1
+#define SLEEP_IDLE_MS           120000  // Advertising with no central
+#define SLEEP_STILL_MS          600000  // Streaming or logging with no motion (0 = never)
+#define SLEEP_MOTION_GYRO_DPS   30.0f   // Rotation that counts as activity while awake
+#define WAKE_MOTION_MG          80      // High-pass filtered accel that wakes the glove
+#define WAKE_MOTION_DURATION    1       // Samples above it
+#define WAKE_CYCLE_RATE         2       // LP_WAKE_CTRL: 20Hz accel sampling while asleep
+#define WAKE_RETRY_S            60      // Timer wake if motion wake can't be armed
+
+// ─── Adaptive Rate ───────────────────────────────────────────────────────────
+// Once the stillness window (stillness.h) has stayed still for
+// ADAPTIVE_IDLE_MS the glove drops to an idle tier: it keeps sampling (and
+// logging, fusing, detecting) at the full rate but streams one sample every
+// ADAPTIVE_IDLE_PERIOD_MS, flagged FLAG_IDLE. Meanwhile INT carries the
+// MPU6050 motion interrupt instead of data-ready, so acquisition wakes on
+// the first sample that moves the accel (or every IMU_WAKE_TIMEOUT_MS) and
+// that drain streams at full rate. Rotation is checked per sample as well.
+// ADAPTIVE_IDLE_MS stays above STILLNESS_WINDOW_MS so the server calibrates
+// on full-rate samples. Requires IMU_FIFO_ENABLED.
+#define ADAPTIVE_RATE_ENABLED   1
+#define ADAPTIVE_IDLE_MS        5000    // Stillness before the idle tier
+#define ADAPTIVE_IDLE_PERIOD_MS 100     // Sample spacing streamed while idle
+#define ADAPTIVE_WAKE_MG        64      // High-pass filtered accel that restores full rate
+#define ADAPTIVE_WAKE_DURATION  1       // Samples above it
+#define ADAPTIVE_WAKE_GYRO_DPS  20.0f   // Rotation that restores full rate
+
+#if ADAPTIVE_RATE_ENABLED && !IMU_FIFO_ENABLED
+    #error "ADAPTIVE_RATE_ENABLED requires IMU_FIFO_ENABLED"
+#endif
+
+// ─── Battery Monitoring ──────────────────────────────────────────────────────
+// LiPo voltage range: 3.0V (empty) to 4.2V (full)
+// With voltage divider: adjust these based on your circuit
+#define VBAT_MIN        3.0f    // Minimum battery voltage (0%)
+#define VBAT_MAX        4.2f    // Maximum battery voltage (100%)
+#define VCHARGE_THRESH  4.0f    // Voltage threshold for "charging" detection
+
+// Background sampler (see power_monitor.h): the packet path only reads its cache
+#define POWER_SAMPLE_MS         200     // Sampler period
+#define POWER_OVERSAMPLE        16      // ADC reads averaged per sample
+#define POWER_FILTER_SHIFT      3       // IIR weight 1/8 (~1.6s time constant)
+#define VCHARGE_HYST_MV         100     // Charging flag hysteresis
+#define POWER_TASK_PRIORITY     1
+#define POWER_TASK_STACK        2048
+
+// ─── Status Output ───────────────────────────────────────────────────────────
+// Runtime Serial output goes through a queue to its own task (status_log.h)
+#define STATUS_LOG_DEPTH        16      // Lines waiting for the writer
+#define STATUS_LOG_LINE         112     // Max line length, newline included
+#define STATUS_LOG_TASK_PRIORITY 1
+#define STATUS_LOG_TASK_STACK   3072
+
+// ─── Diagnostics ─────────────────────────────────────────────────────────────
+// Hot-path stage timing, wake jitter and on-glove loss counters
+// (diagnostics.h), notified on their own characteristic and dumped to Serial
+#define DIAG_ENABLED            1
+#define DIAG_PERIOD_MS          5000    // Publish window
+#define DIAG_LATE_MS            50      // Capture-to-send delay that counts as late
+
+// ─── Status Flags (bit positions) ────────────────────────────────────────────
+#define FLAG_CHARGING       (1 << 0)    // Bit 0: Is charging
+#define FLAG_CALIBRATED     (1 << 1)    // Bit 1: Calibration complete
+#define FLAG_IDLE           (1 << 2)    // Bit 2: Idle rate tier (ADAPTIVE_RATE_ENABLED)
+// Bits 3-7: Reserved for future use
+
+// ─── On-Glove Punch Detection ────────────────────────────────────────────────
+// Must match server/analytics/analyzer.go
+#define PUNCH_THRESHOLD_MS2         25.0f   // m/s² above gravity
+#define PUNCH_DEBOUNCE_MS           300     // ms between valid punches
+#define PUNCH_HOOK_GYRO_THRESH      200.0f  // °/s around the up axis
+#define PUNCH_UPPERCUT_GYRO_THRESH  150.0f  // °/s around a horizontal axis
+#define PUNCH_STRAIGHT_GYRO_MAX     150.0f  // °/s max rotation for a straight
+#define PUNCH_PEAK_WINDOW_MS        100     // Track peaks this long after the crossing
+#define GRAVITY_CAPTURE_SAMPLES     50      // Samples averaged after calibration
+
+// Per-punch features (punch_features.h): every sample goes through a
+// circular window, and each punch is reported as one PunchFeaturePacket
+// reduced from the samples around its threshold crossing
+#define PUNCH_FEATURES_ENABLED      1
+#define PUNCH_PRE_TRIGGER_MS        50      // Window kept before the crossing
+#define PUNCH_POST_TRIGGER_MS       200     // Window after it (covers the retraction)
+#define PUNCH_WINDOW_SAMPLES        256     // Circular window (power of two, ≥ 1kHz × window)
+#define PUNCH_IMPACT_MS2            10.0f   // m/s², linear acceleration that counts as impact
+
+#if PUNCH_POST_TRIGGER_MS >= PUNCH_DEBOUNCE_MS
+    #error "PUNCH_POST_TRIGGER_MS must end before the next punch can trigger"
+#endif
+#if PUNCH_PRE_TRIGGER_MS + PUNCH_POST_TRIGGER_MS >= PUNCH_WINDOW_SAMPLES
+    #error "PUNCH_WINDOW_SAMPLES must hold the pre/post-trigger window at 1kHz"
+#endif
+
+// Gravity capture from a still stretch (stillness.h), the server Analyzer's
+// calibration rule: combined accel and gyro variance over a sliding window
+#define STILLNESS_SAMPLES       50      // Samples for variance calculation
+#define STILLNESS_ACCEL_THRESH  0.5f    // m/s², max combined accel variance (as a deviation)
+#define STILLNESS_GYRO_THRESH   5.0f    // °/s, max combined gyro variance (as a deviation)
+#define STILLNESS_WINDOW_MS     3000    // Stillness needed to take the reference
+
+// ─── Orientation Fusion ──────────────────────────────────────────────────────
+// Fixed-point Mahony filter on every captured sample (orientation_filter.h),
+// started from the calibration gravity reference. Feeds STREAM_MODE_FUSED.
+#define FUSION_ENABLED          1
+#define FUSION_KP               1.0f    // 1/s, accel feedback gain (tilt time constant ~1s)
+#define FUSION_ACCEL_GATE       0.15f   // Accel feedback only within this many g of 1g
+
+// ─── Calibration ─────────────────────────────────────────────────────────────
+#define CALIBRATION_SAMPLES 500     // Number of samples for offset calibration
+// The first-boot calibration waits for STILLNESS_WINDOW_MS of stillness
+
+// Offsets and the gravity reference are kept in NVS (imu_calibration.h):
+// only the first boot runs the blocking calibration. Afterwards the gyro
+// bias is re-estimated whenever the glove lies still for a drift window
+// and the offsets are corrected (and saved) if it has moved.
+#define CAL_PERSIST_ENABLED     1
+#define CAL_NVS_NAMESPACE       "fighterlink"
+#define CAL_DRIFT_WINDOW_MS     2000    // Stillness needed for a bias estimate
+#define CAL_STILL_ACCEL_G       0.05f   // Max per-axis accel span while still
+#define CAL_STILL_GYRO_DPS      3.0f    // Max per-axis gyro span while still
+#define CAL_DRIFT_GYRO_DPS      0.5f    // Residual bias that triggers a correction
+
+// Boot delay so a serial monitor can attach before the banner (debugging only)
+#define SERIAL_WAIT_MS          0
+
+#endif // CONFIG_H
@@ -0,0 +1,54 @@
+/**
+ * FighterLink Diagnostics
+ */
+
+#include "diagnostics.h"
+
+// ─── StageTimer ──────────────────────────────────────────────────────────────
+void StageTimer::add(uint32_t cycles) {
+    _calls.store(_calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    _cycles.store(_cycles.load(std::memory_order_relaxed) + cycles, std::memory_order_relaxed);
+    if (cycles > _peak.load(std::memory_order_relaxed)) {
+        _peak.store(cycles, std::memory_order_relaxed);
+    }
+}
+
+void StageTimer::take(uint32_t& mean, uint32_t& peak) {
+    uint32_t calls = _calls.load(std::memory_order_relaxed);
+    uint32_t cycles = _cycles.load(std::memory_order_relaxed);
+    uint32_t n = calls - _takenCalls;
+    mean = n > 0 ? (cycles - _takenCycles) / n : 0;
+    peak = _peak.exchange(0, std::memory_order_relaxed);
+    _takenCalls = calls;
+    _takenCycles = cycles;
+}
+
+// ─── JitterHistogram ─────────────────────────────────────────────────────────
+void JitterHistogram::mark(uint32_t nowUs) {
+    uint32_t period = nowUs - _last;
+    _last = nowUs;
+    if (_marks < 2) {
+        _period = period;
+        _marks++;
+        return;
+    }
+
+    uint32_t jitter = period > _period ? period - _period : _period - period;
+    _period = period;
+    uint8_t bucket = 0;
+    for (uint32_t limit = DIAG_JITTER_BASE_US; jitter >= limit && bucket < DIAG_JITTER_BUCKETS - 1;
+         limit <<= 1) {
+        bucket++;
+    }
+    _buckets[bucket].store(_buckets[bucket].load(std::memory_order_relaxed) + 1,
+                           std::memory_order_relaxed);
+}
+
+void JitterHistogram::take(uint16_t* out) {
+    for (int i = 0; i < DIAG_JITTER_BUCKETS; i++) {
+        uint32_t count = _buckets[i].load(std::memory_order_relaxed);
+        uint32_t n = count - _taken[i];
+        out[i] = n > UINT16_MAX ? UINT16_MAX : (uint16_t)n;
+        _taken[i] = count;
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * FighterLink Diagnostics
+ *
+ * Where the time goes on the glove. Each hot-path stage is timed on the CPU
+ * cycle counter, acquisition wakes feed a period-jitter histogram, and
+ * samples lost on the glove itself are counted, so a central can tell
+ * firmware stalls apart from radio loss.
+ *
+ * Value of the diagnostics characteristic, published every DIAG_PERIOD_MS
+ * while connected. Stage and jitter fields cover the window since the last
+ * publish; counters run from boot.
+ *
+ * Field          | Offset | Size | Type      | Units
+ * ---------------|--------|------|-----------|--------------------------------
+ * uptime         | 0      | 4    | uint32    | ms
+ * cpuMhz         | 4      | 2    | uint16    | MHz (cycles per µs)
+ * window         | 6      | 2    | uint16    | ms covered by stage/jitter fields
+ * stageMean[4]   | 8      | 16   | uint32 ×4 | cycles per call, DiagStage order
+ * stageMax[4]    | 24     | 16   | uint32 ×4 | cycles
+ * jitter[8]      | 40     | 16   | uint16 ×8 | wakes; bucket n < 32µs << n, last open
+ * dropped        | 56     | 4    | uint32    | samples lost between acquisition and BLE
+ * fifoResets     | 60     | 4    | uint32    | MPU6050 FIFO overflow resets
+ * late           | 64     | 4    | uint32    | samples older than DIAG_LATE_MS when sent
+ * notifyFailures | 68     | 4    | uint32    | notifications the BLE stack refused
+ * heapFree       | 72     | 4    | uint32    | bytes
+ * heapMin        | 76     | 4    | uint32    | bytes, low-water mark since boot
+ *
+ * Jitter is the change in wake period from one acquisition wake to the next.
+ * Hardware-independent; each timer and histogram has one writer, read by the
+ * publisher.
+ */
+
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+#include <stdint.h>
+#include <atomic>
+
+enum DiagStage : uint8_t {
+    DIAG_STAGE_I2C = 0,     // One FIFO burst (or register) read
+    DIAG_STAGE_CONVERT,     // Offsets, drift tracking, scaling and fusion for one read
+    DIAG_STAGE_BUILD,       // One sample into a packet or batch, or one batch closed
+    DIAG_STAGE_NOTIFY,      // One setValue() + notify() (NimBLE: notify() alone)
+    DIAG_STAGE_COUNT
+};
+
+#define DIAG_JITTER_BUCKETS     8
+#define DIAG_JITTER_BASE_US     32      // Upper bound of bucket 0
+
+struct __attribute__((packed)) DiagnosticsStatus {
+    uint32_t uptime;
+    uint16_t cpuMhz;
+    uint16_t window;
+    uint32_t stageMean[DIAG_STAGE_COUNT];
+    uint32_t stageMax[DIAG_STAGE_COUNT];
+    uint16_t jitter[DIAG_JITTER_BUCKETS];
+    uint32_t dropped;
+    uint32_t fifoResets;
+    uint32_t late;
+    uint32_t notifyFailures;
+    uint32_t heapFree;
+    uint32_t heapMin;
+};
+
+static_assert(sizeof(DiagnosticsStatus) == 80, "DiagnosticsStatus must be exactly 80 bytes");
+
+// Cycle totals for one stage
+class StageTimer {
+public:
+    void add(uint32_t cycles);
+
+    // Publisher: mean and peak since the last call. A sample landing between
+    // reading and clearing the peak only misses this window's peak.
+    void take(uint32_t& mean, uint32_t& peak);
+
+private:
+    std::atomic<uint32_t> _calls{0};
+    std::atomic<uint32_t> _cycles{0};   // Wraps; windows are far shorter
+    std::atomic<uint32_t> _peak{0};
+    uint32_t _takenCalls = 0;
+    uint32_t _takenCycles = 0;
+};
+
+// Wake-to-wake period changes, log2 buckets
+class JitterHistogram {
+public:
+    void mark(uint32_t nowUs);
+
+    // After a pause in acquisition (reconnect, new profile), so the gap
+    // isn't counted
+    void restart() { _marks = 0; }
+
+    // Publisher: counts per bucket since the last call
+    void take(uint16_t* out);
+
+private:
+    std::atomic<uint32_t> _buckets[DIAG_JITTER_BUCKETS] = {};
+    uint32_t _taken[DIAG_JITTER_BUCKETS] = {};
+    uint32_t _last = 0;
+    uint32_t _period = 0;
+    uint8_t _marks = 0;     // Up to 2: a jitter needs two periods
+};
+
+#endif // DIAGNOSTICS_H
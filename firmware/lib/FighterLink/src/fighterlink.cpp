@@ -0,0 +1,2252 @@
+/**
+ * FighterLink Boxing Glove Firmware
+ * 
+ * BLE Peripheral that streams MPU6050 sensor data at 100Hz-1kHz.
+ * Automatically starts advertising on power-up.
+ * 
+ * Hardware: Seeed Studio XIAO ESP32C3 or ESP32 DevKit + MPU6050 (board_traits.h)
+ * 
+ * LED States:
+ *   - Slow blink (1s): Initializing / Calibrating
+ *   - Fast blink (200ms): Advertising, waiting for connection
+ *   - Solid ON: Connected, streaming data
+ *   - Double blink: Session event acknowledgment
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include "config.h"
+#if BLE_STACK == BLE_STACK_NIMBLE
+#include <NimBLEDevice.h>       // Maps the BLE* class names onto NimBLE's
+#else
+#include <BLEDevice.h>
+#include <BLEServer.h>
+#include <BLEUtils.h>
+#include <BLE2902.h>
+#include <esp_gap_ble_api.h>
+#endif
+#include <esp_sleep.h>
+#include <soc/soc_caps.h>
+#include <MPU6050_light.h>
+
+#include "fighterlink.h"
+#include "board_traits.h"
+#include "sensor_packet.h"
+#include "imu_fifo.h"
+#include "rate_profile.h"
+#include "ring_buffer.h"
+#include "sample_scale.h"
+#include "sample_batcher.h"
+#include "stream_control.h"
+#include "link_status.h"
+#include "clock_sync.h"
+#include "punch_detector.h"
+#if PUNCH_FEATURES_ENABLED
+#include "punch_features.h"
+#endif
+#include "power_monitor.h"
+#include "status_led.h"
+#include "status_log.h"
+#include "imu_calibration.h"
+#include "stillness.h"
+#include "diagnostics.h"
+#if FUSION_ENABLED
+#include "orientation_filter.h"
+#endif
+#if SAMPLE_LOG_ENABLED
+#include "sample_log.h"
+#endif
+#if RESEND_ENABLED
+#include "resend_buffer.h"
+#endif
+#if SCALE_BENCHMARK
+#include "scale_benchmark.h"
+#endif
+#if USB_TRANSPORT_ENABLED
+#include "usb_frame.h"
+#endif
+
+static_assert(RATE_PROFILE == RATE_PROFILE_100HZ || (BATCH_ENABLED && IMU_FIFO_ENABLED),
+              "RATE_PROFILE above 100Hz requires BATCH_ENABLED and IMU_FIFO_ENABLED");
+
+#if BROADCAST_ENABLED && !SOC_BLE_50_SUPPORTED
+    #error "BROADCAST_ENABLED requires a BLE 5 target (extended advertising)"
+#endif
+#if BROADCAST_ENABLED && BLE_STACK == BLE_STACK_NIMBLE
+    #error "BROADCAST_ENABLED requires BLE_STACK_BLUEDROID"
+#endif
+#if USB_TRANSPORT_ENABLED && !(SOC_USB_SERIAL_JTAG_SUPPORTED && ARDUINO_USB_CDC_ON_BOOT)
+    #error "USB_TRANSPORT_ENABLED requires native USB CDC (ESP32-C3, ARDUINO_USB_CDC_ON_BOOT)"
+#endif
+#if USB_TRANSPORT_ENABLED && BROADCAST_ENABLED
+    #error "USB_TRANSPORT_ENABLED and BROADCAST_ENABLED are exclusive"
+#endif
+
+// ─── Global Objects ──────────────────────────────────────────────────────────
+MPU6050 mpu(Wire);
+
+BLEServer* g_pServer = nullptr;
+BLECharacteristic* g_pSensorChar = nullptr;
+BLECharacteristic* g_pBatteryChar = nullptr;
+BLECharacteristic* g_pDeviceChar = nullptr;
+BLECharacteristic* g_pControlChar = nullptr;
+BLECharacteristic* g_pStatusChar = nullptr;
+BLECharacteristic* g_pSyncChar = nullptr;
+BLECharacteristic* g_pBulkChar = nullptr;
+#if BLE_STACK == BLE_STACK_BLUEDROID
+BLE2902* g_pBulkCccd = nullptr;    // NimBLE tracks subscriptions itself
+#endif
+BLECharacteristic* g_pDiagChar = nullptr;
+
+// ─── Global State ────────────────────────────────────────────────────────────
+uint8_t g_handId = HAND_LEFT;
+volatile bool g_deviceConnected = false;
+volatile bool g_oldDeviceConnected = false;
+
+volatile uint16_t g_peerMtu = BLE_DEFAULT_MTU;
+LinkStatus g_linkStatus = {};           // Granted link parameters (BLE stack)
+volatile bool g_linkStatusDirty = false;  // BLE stack → loop()
+QueueHandle_t g_syncQueue = nullptr;    // Pending echo: BLE stack → sender, depth 1
+
+uint32_t g_sequenceNumber = 0;     // Sample counter (SensorPacket carries the low 16 bits)
+uint32_t g_lastSampleTime = 0;
+uint32_t g_lastSampleStamp = 0;     // Timestamp of the newest drained sample
+bool g_sampleClockValid = false;
+uint32_t g_lastBatteryTime = 0;
+bool g_isCalibrated = false;
+
+StreamConfig g_config = defaultStreamConfig();     // Sensor side; owned by acquisition
+const RateProfile* g_profile = &rateProfile(RATE_PROFILE);
+StreamConfig g_streamConfig = defaultStreamConfig();   // Transmission side's copy of g_config
+const RateProfile* g_streamProfile = &rateProfile(RATE_PROFILE);
+QueueHandle_t g_streamQueue = nullptr;      // Acquisition → transmission side, depth 1
+StreamConfig g_requestedConfig = defaultStreamConfig();  // Last accepted write (BLE stack)
+QueueHandle_t g_controlQueue = nullptr;     // BLE stack → acquisition, depth 1
+volatile uint8_t g_latencyEvery = 0;        // Sensor frames per latency trace: BLE stack → sender
+uint8_t g_latencyFrames = 0;                // Sensor frames since the last trace (sender)
+
+SampleBatcher g_batcher(rateProfile(RATE_PROFILE).periodUs, BATCH_ENCODING);
+uint16_t g_batchMtu = 0;            // MTU g_batcher is currently sized for
+uint32_t g_batchStartTime = 0;
+
+PunchDetector g_punchDetector;
+uint32_t g_lastHeartbeatTime = 0;
+#if PUNCH_FEATURES_ENABLED
+PunchWindow g_punchWindow;
+#endif
+
+ImuCalibration g_calibration = {};  // Offsets and gravity reference; owned by acquisition
+ImuRawSample g_imuOffsets = {};     // g_calibration offsets in raw LSB for the active ranges
+
+#if FUSION_ENABLED
+OrientationFilter g_fusion;         // Acquisition side
+#endif
+
+#if ADAPTIVE_RATE_ENABLED
+StillnessWindow g_idleWindow;       // Acquisition side
+uint32_t g_stillSince = 0;          // Sample time g_idleWindow turned still
+bool g_rateIdle = false;            // Acquisition's tier, stamped on each TimedRecord
+bool g_idleTier = false;            // Tier of the samples being sent (transmission side)
+uint32_t g_lastIdleSample = 0;      // Last sample streamed in the idle tier
+#endif
+
+#if BROADCAST_ENABLED
+BLEMultiAdvertising g_broadcast(1); // Advertising set 0 carries the stream
+uint8_t g_broadcastData[BROADCAST_ADV_BYTES];   // Name AD, then header + frame
+size_t g_broadcastPrefix = 0;       // Bytes of the name AD
+uint8_t g_broadcastCounter = 0;     // Transmission side
+#endif
+
+#if USB_TRANSPORT_ENABLED
+uint8_t g_usbFrame[USB_FRAME_MAX_BYTES];    // Transmission side
+UsbFrameReader g_usbReader;         // loop(): control writes from the host
+uint32_t g_usbDropped = 0;          // Frames the TX buffer had no room for
+#endif
+
+#if CAL_PERSIST_ENABLED
+DriftMonitor g_driftMonitor;        // Acquisition side
+QueueHandle_t g_gravityQueue = nullptr;     // Acquisition → sender (punch detector), depth 1
+QueueHandle_t g_calibrationQueue = nullptr; // Acquisition → loop() (NVS write), depth 1
+#endif
+
+#if IMU_FIFO_ENABLED
+// Converted on the acquisition side, so a live range change can't mis-scale
+// samples that are already queued
+struct TimedRecord {
+    uint32_t timestamp;     // µs
+    SampleRecord record;
+    SampleRecord lsb;       // The same sample in offset-corrected LSB (v2 frames)
+    FusionRecord fusion;    // Zero without FUSION_ENABLED
+    bool idle;              // Captured in the idle rate tier
+};
+
+RingBuffer<TimedRecord, SAMPLE_RING_SIZE> g_sampleRing;    // Acquisition → BLE sender
+#endif
+
+#if IMU_INTERRUPT_ENABLED
+RingBuffer<int64_t, IMU_STAMP_RING_SIZE> g_stampRing;     // ISR → acquisition (µs)
+TaskHandle_t g_imuTask = nullptr;   // Task woken by the data-ready ISR
+#endif
+
+#if SAMPLE_LOG_ENABLED
+// Owned by the transmission side (BLE task, or loop() without the pipeline)
+SampleLog g_sampleLog;
+SampleBatcher g_logBatcher(rateProfile(RATE_PROFILE).periodUs, ENCODING_DELTA);
+volatile bool g_logging = false;    // Transmission side → acquisition
+uint32_t g_backfillFrames = 0;      // Replayed since the last reconnect
+#endif
+
+#if RESEND_ENABLED
+// Owned by the transmission side; NACKs arrive from the BLE stack
+ResendBuffer g_resendBuffer;
+QueueHandle_t g_resendQueue = nullptr;  // BLE stack → sender, RESEND_QUEUE_DEPTH
+uint32_t g_resendNext = 0;          // Request being served: [next, end)
+uint32_t g_resendEnd = 0;
+#endif
+
+#if PIPELINE_ENABLED
+TaskHandle_t g_acqTask = nullptr;
+TaskHandle_t g_bleTask = nullptr;
+volatile bool g_captureRestart = false;     // loop() → acquisition task
+volatile bool g_streamRestart = false;      // Acquisition task → BLE task, after g_streamQueue
+#endif
+
+#if SLEEP_ENABLED
+// Survives deep sleep (not a power-on reset), so a motion wake resumes with
+// the calibration in effect when the glove went to sleep
+struct RtcState {
+    uint32_t magic;
+    bool calibrated;
+    ImuCalibration calibration;
+    uint32_t sleeps;            // Deep sleeps since power-on
+};
+
+#define RTC_STATE_MAGIC     0x464C5253  // "FLRS"
+
+RTC_DATA_ATTR RtcState g_rtcState;
+bool g_resumed = false;             // This boot is a wake from deep sleep
+volatile uint32_t g_lastActivityTime = 0;   // millis() of the last motion or link change
+const char* volatile g_sleepReason = nullptr;   // loop() → bus owner
+#endif
+
+#if DIAG_ENABLED
+StageTimer g_stageTimers[DIAG_STAGE_COUNT];     // I2C/convert: acquisition, build/notify: sender
+JitterHistogram g_wakeJitter;       // Acquisition side
+uint32_t g_lateSamples = 0;         // Transmission side
+uint32_t g_notifyFailures = 0;      // Transmission side (sensor/bulk notify status)
+uint32_t g_notifyCount = 0;         // Transmission side, per window
+uint32_t g_notifyBytes = 0;
+uint32_t g_lastDiagTime = 0;
+#endif
+
+// ─── Sample Clock ────────────────────────────────────────────────────────────
+// Every timestamp on air: esp_timer µs, low 32 bits (see clock_sync.h)
+static inline uint32_t sampleClockUs() {
+    return (uint32_t)esp_timer_get_time();
+}
+
+// ─── Hot-Path Timing ─────────────────────────────────────────────────────────
+// CPU cycle counter around each stage (see diagnostics.h); compiles away
+// without DIAG_ENABLED
+#if DIAG_ENABLED
+static inline uint32_t diagCycles() {
+    return ESP.getCycleCount();
+}
+
+// Charge the cycles since start to a stage; returns the end so the next
+// stage can start from it
+static inline uint32_t diagStage(DiagStage stage, uint32_t start) {
+    uint32_t now = ESP.getCycleCount();
+    g_stageTimers[stage].add(now - start);
+    return now;
+}
+
+// Acquisition side, once per drain
+static inline void diagWake() {
+    g_wakeJitter.mark(sampleClockUs());
+}
+#else
+static inline uint32_t diagCycles() { return 0; }
+static inline uint32_t diagStage(DiagStage, uint32_t) { return 0; }
+static inline void diagWake() {}
+#endif
+
+// ─── BLE Callbacks ───────────────────────────────────────────────────────────
+// Ask the central for a fast, wide link. The peripheral can't start the MTU
+// exchange itself; it only offers BLE_LOCAL_MTU when the central does.
+#if BLE_STACK == BLE_STACK_NIMBLE
+void requestLinkParams(uint16_t connHandle) {
+    g_pServer->updateConnParams(connHandle, BLE_CONN_INTERVAL_MIN, BLE_CONN_INTERVAL_MAX,
+                                BLE_CONN_LATENCY, BLE_CONN_TIMEOUT);
+    g_pServer->setDataLen(connHandle, BLE_DATA_LENGTH);
+#if SOC_BLE_50_SUPPORTED && BLE_PREFER_2M_PHY
+    ble_gap_set_prefered_le_phy(connHandle, BLE_GAP_LE_PHY_2M_MASK, BLE_GAP_LE_PHY_2M_MASK,
+                                BLE_GAP_LE_PHY_CODED_ANY);
+#endif
+}
+
+// What the central granted arrives as GAP events (NimBLE's own phy values
+// are the HCI ones link_status.h uses)
+int onGapEvent(ble_gap_event* event, void* arg) {
+    switch (event->type) {
+    case BLE_GAP_EVENT_CONN_UPDATE: {
+        ble_gap_conn_desc desc;
+        if (event->conn_update.status != 0 ||
+            ble_gap_conn_find(event->conn_update.conn_handle, &desc) != 0) return 0;
+        g_linkStatus.interval = desc.conn_itvl;
+        g_linkStatus.latency = desc.conn_latency;
+        g_linkStatus.timeout = desc.supervision_timeout;
+        break;
+    }
+#ifdef BLE_GAP_EVENT_DATA_LEN_CHG
+    case BLE_GAP_EVENT_DATA_LEN_CHG:
+        g_linkStatus.txOctets = event->data_len_chg.max_tx_octets;
+        g_linkStatus.rxOctets = event->data_len_chg.max_rx_octets;
+        break;
+#endif
+    case BLE_GAP_EVENT_PHY_UPDATE_COMPLETE:
+        if (event->phy_updated.status != 0) return 0;
+        g_linkStatus.txPhy = event->phy_updated.tx_phy;
+        g_linkStatus.rxPhy = event->phy_updated.rx_phy;
+        break;
+    default:
+        return 0;
+    }
+    g_linkStatusDirty = true;
+    return 0;
+}
+#else
+void requestLinkParams(esp_bd_addr_t bda) {
+    g_pServer->updateConnParams(bda, BLE_CONN_INTERVAL_MIN, BLE_CONN_INTERVAL_MAX,
+                                BLE_CONN_LATENCY, BLE_CONN_TIMEOUT);
+    esp_ble_gap_set_pkt_data_len(bda, BLE_DATA_LENGTH);
+#if SOC_BLE_50_SUPPORTED && BLE_PREFER_2M_PHY
+    esp_ble_gap_set_prefered_phy(bda, 0, ESP_BLE_GAP_PHY_2M_PREF_MASK,
+                                 ESP_BLE_GAP_PHY_2M_PREF_MASK, ESP_BLE_GAP_PHY_OPTIONS_NO_PREF);
+#endif
+}
+
+// What the central granted arrives as GAP events
+void onGapEvent(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param) {
+    switch (event) {
+    case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+        if (param->update_conn_params.status != ESP_BT_STATUS_SUCCESS) return;
+        g_linkStatus.interval = param->update_conn_params.conn_int;
+        g_linkStatus.latency = param->update_conn_params.latency;
+        g_linkStatus.timeout = param->update_conn_params.timeout;
+        break;
+    case ESP_GAP_BLE_SET_PKT_LENGTH_COMPLETE_EVT:
+        if (param->pkt_data_length_cmpl.status != ESP_BT_STATUS_SUCCESS) return;
+        g_linkStatus.txOctets = param->pkt_data_length_cmpl.params.tx_len;
+        g_linkStatus.rxOctets = param->pkt_data_length_cmpl.params.rx_len;
+        break;
+#if SOC_BLE_50_SUPPORTED
+    case ESP_GAP_BLE_PHY_UPDATE_COMPLETE_EVT:
+        if (param->phy_update.status != ESP_BT_STATUS_SUCCESS) return;
+        g_linkStatus.txPhy = param->phy_update.tx_phy;
+        g_linkStatus.rxPhy = param->phy_update.rx_phy;
+        break;
+#endif
+    default:
+        return;
+    }
+    g_linkStatusDirty = true;
+}
+#endif
+
+// Whatever the central opened the link with, until it grants more
+void linkOpened(uint16_t interval, uint16_t latency, uint16_t timeout) {
+    g_peerMtu = BLE_DEFAULT_MTU;
+    
+    g_linkStatus.interval = interval;
+    g_linkStatus.latency = latency;
+    g_linkStatus.timeout = timeout;
+    g_linkStatus.mtu = BLE_DEFAULT_MTU;
+    g_linkStatus.txOctets = LINK_DEFAULT_OCTETS;
+    g_linkStatus.rxOctets = LINK_DEFAULT_OCTETS;
+    g_linkStatus.txPhy = LINK_PHY_1M;
+    g_linkStatus.rxPhy = LINK_PHY_1M;
+    g_linkStatusDirty = true;
+    
+    g_deviceConnected = true;
+    statusLog("BLE: Client connected\n");
+}
+
+void mtuChanged(uint16_t mtu) {
+    g_peerMtu = mtu;
+    g_linkStatus.mtu = mtu;
+    g_linkStatusDirty = true;
+    statusLog("BLE: MTU negotiated to %d\n", mtu);
+}
+
+class ServerCallbacks : public BLEServerCallbacks {
+#if BLE_STACK == BLE_STACK_NIMBLE
+    void onConnect(BLEServer* pServer, ble_gap_conn_desc* desc) override {
+        linkOpened(desc->conn_itvl, desc->conn_latency, desc->supervision_timeout);
+        requestLinkParams(desc->conn_handle);
+    }
+
+    void onMTUChange(uint16_t mtu, ble_gap_conn_desc* desc) override {
+        mtuChanged(mtu);
+    }
+#else
+    void onConnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) override {
+        linkOpened(param->connect.conn_params.interval, param->connect.conn_params.latency,
+                   param->connect.conn_params.timeout);
+        requestLinkParams(param->connect.remote_bda);
+    }
+
+    void onMtuChanged(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) override {
+        mtuChanged(param->mtu.mtu);
+    }
+#endif
+
+    void onDisconnect(BLEServer* pServer) override {
+        g_deviceConnected = false;
+        // The next central starts from the boot defaults
+        g_latencyEvery = 0;
+        g_requestedConfig = defaultStreamConfig();
+        xQueueOverwrite(g_controlQueue, &g_requestedConfig);
+        statusLog("BLE: Client disconnected\n");
+    }
+};
+
+// A control-characteristic write (or one from the USB host): validate and
+// hand over; the acquisition side applies it between samples
+void handleControlWrite(const uint8_t* data, size_t length) {
+#if RESEND_ENABLED
+    ResendRequest resend;
+    if (parseResendWrite(data, length, resend)) {
+        xQueueSend(g_resendQueue, &resend, 0);  // Full: the gap stays lost
+#if PIPELINE_ENABLED
+        xTaskNotifyGive(g_bleTask);
+#endif
+        return;
+    }
+#endif
+    uint8_t latencyEvery;
+    if (parseLatencyWrite(data, length, latencyEvery)) {
+        g_latencyEvery = latencyEvery;
+        return;
+    }
+    
+    StreamConfig config = g_requestedConfig;
+    if (!parseControlWrite(data, length, config)) {
+        statusLog("Control: Rejected write\n");
+        return;
+    }
+    g_requestedConfig = config;
+    xQueueOverwrite(g_controlQueue, &config);
+}
+
+// Runs in the BLE stack
+class ControlCallbacks : public BLECharacteristicCallbacks {
+    void onWrite(BLECharacteristic* pChar) override {
+#if BLE_STACK == BLE_STACK_NIMBLE
+        NimBLEAttValue value = pChar->getValue();
+        handleControlWrite(value.data(), value.length());
+#else
+        handleControlWrite(pChar->getData(), pChar->getLength());
+#endif
+    }
+};
+
+// Stamp the ping on arrival; the sender stamps the echo when it goes out
+class SyncCallbacks : public BLECharacteristicCallbacks {
+    void onWrite(BLECharacteristic* pChar) override {
+        uint32_t rxTime = sampleClockUs();
+#if BLE_STACK == BLE_STACK_NIMBLE
+        NimBLEAttValue value = pChar->getValue();
+        if (value.length() != SYNC_PING_SIZE) return;
+        const uint8_t* ping = value.data();
+#else
+        if (pChar->getLength() != SYNC_PING_SIZE) return;
+        const uint8_t* ping = pChar->getData();
+#endif
+        
+        SyncEcho echo;
+        memcpy(&echo.token, ping, SYNC_PING_SIZE);
+        echo.rxTime = rxTime;
+        echo.txTime = 0;
+        xQueueOverwrite(g_syncQueue, &echo);
+#if PIPELINE_ENABLED
+        xTaskNotifyGive(g_bleTask);
+#endif
+    }
+};
+
+#if DIAG_ENABLED
+// Runs inside notify() on the sending task: count what the stack refused
+class NotifyStatusCallbacks : public BLECharacteristicCallbacks {
+#if BLE_STACK == BLE_STACK_NIMBLE
+    void onStatus(BLECharacteristic* pChar, Status s, int code) override {
+#else
+    void onStatus(BLECharacteristic* pChar, Status s, uint32_t code) override {
+#endif
+        if (s != SUCCESS_NOTIFY && s != SUCCESS_INDICATE) {
+            g_notifyFailures++;
+        }
+    }
+};
+#endif
+
+// ─── IMU Data-Ready Interrupt ────────────────────────────────────────────────
+#if IMU_INTERRUPT_ENABLED
+// Fires once per sample written to the FIFO: stamp it and wake the consumer
+void IRAM_ATTR onImuDataReady() {
+    g_stampRing.push(esp_timer_get_time());  // Full ring is counted in overruns()
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(g_imuTask, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+#endif
+
+// ─── Broadcast ───────────────────────────────────────────────────────────────
+#if BROADCAST_ENABLED
+// Advertise frame as the current payload; the controller repeats it every
+// interval until the next one replaces it
+void broadcastFrame(const uint8_t* frame, size_t length) {
+    BroadcastHeader header = {BROADCAST_COMPANY_ID, BROADCAST_VERSION, BROADCAST_ATHLETE_ID,
+                              g_handId, g_broadcastCounter++};
+    uint8_t* ad = g_broadcastData + g_broadcastPrefix;
+    ad[0] = 1 + sizeof(BroadcastHeader) + length;
+    ad[1] = ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE;
+    memcpy(ad + 2, &header, sizeof(BroadcastHeader));
+    memcpy(ad + 2 + sizeof(BroadcastHeader), frame, length);
+    g_broadcast.setAdvertisingData(0, g_broadcastPrefix + 2 + sizeof(BroadcastHeader) + length,
+                                   g_broadcastData);
+}
+
+// Non-connectable, non-scannable extended advertising in place of waiting
+// for a central. The stream starts as if one had connected, with batches
+// sized to what fits behind the name and header.
+void startBroadcast(const char* name) {
+    size_t nameLength = strlen(name);
+    g_broadcastData[0] = 1 + nameLength;
+    g_broadcastData[1] = ESP_BLE_AD_TYPE_NAME_CMPL;
+    memcpy(g_broadcastData + 2, name, nameLength);
+    g_broadcastPrefix = 2 + nameLength;
+
+    esp_ble_gap_ext_adv_params_t params = {};
+    params.type = ESP_BLE_GAP_SET_EXT_ADV_PROP_NONCONN_NONSCANNABLE_UNDIRECTED;
+    params.interval_min = BROADCAST_INTERVAL_MS * 8 / 5;   // 0.625ms units
+    params.interval_max = params.interval_min;
+    params.channel_map = ADV_CHNL_ALL;
+    params.own_addr_type = BLE_ADDR_TYPE_PUBLIC;
+    params.filter_policy = ADV_FILTER_ALLOW_SCAN_ANY_CON_ANY;
+    params.tx_power = EXT_ADV_TX_PWR_NO_PREFERENCE;
+    params.primary_phy = ESP_BLE_GAP_PHY_1M;
+    params.secondary_phy = BLE_PREFER_2M_PHY ? ESP_BLE_GAP_PHY_2M : ESP_BLE_GAP_PHY_1M;
+    g_broadcast.setAdvertisingParams(0, &params);
+    broadcastFrame(nullptr, 0);     // Header only until the first frame
+    g_broadcast.start();
+
+    g_peerMtu = BROADCAST_ADV_BYTES - g_broadcastPrefix - 2 - sizeof(BroadcastHeader) + 3;
+    g_deviceConnected = true;
+}
+#endif
+
+// ─── USB Transport ───────────────────────────────────────────────────────────
+#if USB_TRANSPORT_ENABLED
+// Queue frame for the host in one write, so no status line lands inside it.
+// Without room for all of it the frame is dropped whole.
+void usbSendFrame(const uint8_t* frame, size_t length) {
+    size_t bytes = usbFrameEncode(g_handId, frame, length, g_usbFrame);
+    if (bytes == 0 || Serial.availableForWrite() < (int)bytes) {
+        g_usbDropped++;
+        return;
+    }
+    Serial.write(g_usbFrame, bytes);
+}
+
+// The host is always there: the stream starts as if a central had
+// connected, with batches at the full frame size
+void startUsbTransport() {
+    g_peerMtu = USB_FRAME_MAX_PAYLOAD + 3;
+    g_deviceConnected = true;
+}
+
+// loop(): control writes from the host, framed like the stream
+void pollUsbControl() {
+    while (Serial.available() > 0) {
+        if (g_usbReader.feed((uint8_t)Serial.read())) {
+            handleControlWrite(g_usbReader.data(), g_usbReader.length());
+        }
+    }
+}
+#endif
+
+// ─── BLE Setup ───────────────────────────────────────────────────────────────
+#if BLE_STACK == BLE_STACK_NIMBLE
+#define BLE_STACK_NAME  "NimBLE"
+constexpr uint32_t PROP_READ = NIMBLE_PROPERTY::READ;
+constexpr uint32_t PROP_WRITE = NIMBLE_PROPERTY::WRITE;
+constexpr uint32_t PROP_WRITE_NR = NIMBLE_PROPERTY::WRITE_NR;
+constexpr uint32_t PROP_NOTIFY = NIMBLE_PROPERTY::NOTIFY;
+#else
+#define BLE_STACK_NAME  "Bluedroid"
+constexpr uint32_t PROP_READ = BLECharacteristic::PROPERTY_READ;
+constexpr uint32_t PROP_WRITE = BLECharacteristic::PROPERTY_WRITE;
+constexpr uint32_t PROP_WRITE_NR = BLECharacteristic::PROPERTY_WRITE_NR;
+constexpr uint32_t PROP_NOTIFY = BLECharacteristic::PROPERTY_NOTIFY;
+#endif
+
+const char* deviceName() {
+    return g_handId == HAND_LEFT ? BLE_DEVICE_NAME_LEFT : BLE_DEVICE_NAME_RIGHT;
+}
+
+// CCCD for a NOTIFY characteristic; NimBLE adds its own
+void addCccd(BLECharacteristic* pChar) {
+#if BLE_STACK == BLE_STACK_BLUEDROID
+    pChar->addDescriptor(new BLE2902());
+#endif
+}
+
+// Whether the central turned on bulk notifications
+bool bulkSubscribed() {
+#if BLE_STACK == BLE_STACK_NIMBLE
+    return g_pBulkChar->getSubscribedCount() > 0;
+#else
+    return g_pBulkCccd->getNotifications();
+#endif
+}
+
+void setupBLE() {
+    Serial.println("BLE: Initializing " BLE_STACK_NAME "...");
+    uint32_t heapBefore = ESP.getFreeHeap();
+    
+    // Initialize BLE with device name
+    BLEDevice::init(deviceName());
+    BLEDevice::setMTU(BLE_LOCAL_MTU);
+    BLEDevice::setCustomGapHandler(onGapEvent);
+    
+    // Create BLE Server
+    g_pServer = BLEDevice::createServer();
+    g_pServer->setCallbacks(new ServerCallbacks());
+#if BLE_STACK == BLE_STACK_NIMBLE
+    g_pServer->advertiseOnDisconnect(false);    // loop() restarts it, as on Bluedroid
+    
+    // Create FighterLink Service (NimBLE counts the handles itself)
+    BLEService* pService = g_pServer->createService(BLE_SERVICE_UUID);
+#else
+    
+    // Create FighterLink Service (the default 15 handles don't hold them all)
+    BLEService* pService = g_pServer->createService(BLEUUID(BLE_SERVICE_UUID), BLE_SERVICE_HANDLES);
+#endif
+    
+    // Create Sensor Data Characteristic (NOTIFY only)
+    g_pSensorChar = pService->createCharacteristic(
+        BLE_CHAR_SENSOR_UUID,
+        PROP_NOTIFY
+    );
+    addCccd(g_pSensorChar);  // CCCD for notifications
+    
+    // Create Battery Level Characteristic (READ + NOTIFY)
+    g_pBatteryChar = pService->createCharacteristic(
+        BLE_CHAR_BATTERY_UUID,
+        PROP_READ | PROP_NOTIFY
+    );
+    addCccd(g_pBatteryChar);
+    uint8_t initBattery = powerBatteryPercent();
+    g_pBatteryChar->setValue(&initBattery, 1);
+    
+    // Create Device Info Characteristic (READ only - returns hand ID)
+    g_pDeviceChar = pService->createCharacteristic(
+        BLE_CHAR_DEVICE_UUID,
+        PROP_READ
+    );
+    g_pDeviceChar->setValue(&g_handId, 1);
+    
+    // Create Control Characteristic (READ + WRITE + NOTIFY - stream config)
+    g_pControlChar = pService->createCharacteristic(
+        BLE_CHAR_CONTROL_UUID,
+        PROP_READ | PROP_WRITE | PROP_NOTIFY
+    );
+    addCccd(g_pControlChar);
+    g_pControlChar->setCallbacks(new ControlCallbacks());
+    g_pControlChar->setValue((uint8_t*)&g_config, sizeof(StreamConfig));
+    
+    // Create Link Status Characteristic (READ + NOTIFY - granted link parameters)
+    g_pStatusChar = pService->createCharacteristic(
+        BLE_CHAR_STATUS_UUID,
+        PROP_READ | PROP_NOTIFY
+    );
+    addCccd(g_pStatusChar);
+    g_pStatusChar->setValue((uint8_t*)&g_linkStatus, sizeof(LinkStatus));
+    
+    // Create Clock Sync Characteristic (WRITE + NOTIFY - ping/echo)
+    g_pSyncChar = pService->createCharacteristic(
+        BLE_CHAR_SYNC_UUID,
+        PROP_WRITE | PROP_WRITE_NR | PROP_NOTIFY
+    );
+    addCccd(g_pSyncChar);
+    g_pSyncChar->setCallbacks(new SyncCallbacks());
+    
+    // Create Bulk Characteristic (NOTIFY - disconnect log backfill)
+    g_pBulkChar = pService->createCharacteristic(
+        BLE_CHAR_BULK_UUID,
+        PROP_NOTIFY
+    );
+#if BLE_STACK == BLE_STACK_BLUEDROID
+    g_pBulkCccd = new BLE2902();
+    g_pBulkChar->addDescriptor(g_pBulkCccd);
+#endif
+    
+#if DIAG_ENABLED
+    // Create Diagnostics Characteristic (READ + NOTIFY - hot-path timing and loss)
+    g_pDiagChar = pService->createCharacteristic(
+        BLE_CHAR_DIAG_UUID,
+        PROP_READ | PROP_NOTIFY
+    );
+    addCccd(g_pDiagChar);
+    DiagnosticsStatus initDiag = {};
+    g_pDiagChar->setValue((uint8_t*)&initDiag, sizeof(DiagnosticsStatus));
+    
+    // Sample traffic reports failed notifications back
+    NotifyStatusCallbacks* notifyStatus = new NotifyStatusCallbacks();
+    g_pSensorChar->setCallbacks(notifyStatus);
+    g_pBulkChar->setCallbacks(notifyStatus);
+#endif
+    
+    // Start the service
+    pService->start();
+    
+#if BROADCAST_ENABLED
+    // The table stays for local reads; nothing can connect to use it
+    startBroadcast(deviceName());
+    Serial.printf("BLE: Broadcasting as '%s', athlete %d\n", deviceName(), BROADCAST_ATHLETE_ID);
+#elif USB_TRANSPORT_ENABLED
+    // Same table, not advertised: the stream goes out over USB
+    startUsbTransport();
+    Serial.printf("USB: Streaming as '%s'\n", deviceName());
+#else
+    // Start advertising
+    BLEAdvertising* pAdvertising = BLEDevice::getAdvertising();
+    pAdvertising->addServiceUUID(BLE_SERVICE_UUID);
+    pAdvertising->setScanResponse(true);
+    pAdvertising->setMinPreferred(0x06);  // Help with iPhone connections
+    pAdvertising->setMinPreferred(0x12);
+    BLEDevice::startAdvertising();
+    
+    Serial.printf("BLE: Advertising as '%s'\n", deviceName());
+#endif
+    uint32_t heapAfter = ESP.getFreeHeap();
+    Serial.printf("BLE: " BLE_STACK_NAME " took %uKB heap, %uKB free\n",
+                  (unsigned)((heapBefore - heapAfter) / 1024), (unsigned)(heapAfter / 1024));
+}
+
+// ─── Sample Conversion ───────────────────────────────────────────────────────
+// Calibration offsets (g, °/s) → raw LSB for the active ranges, so
+// correction stays integer
+void captureImuOffsets() {
+    const float accelLsb = ACCEL_LSB_PER_G[g_config.accelRange];
+    const float gyroLsb = GYRO_LSB_PER_DPS[g_config.gyroRange];
+    g_imuOffsets.accX  = (int16_t)lroundf(g_calibration.accOffset[0] * accelLsb);
+    g_imuOffsets.accY  = (int16_t)lroundf(g_calibration.accOffset[1] * accelLsb);
+    g_imuOffsets.accZ  = (int16_t)lroundf(g_calibration.accOffset[2] * accelLsb);
+    g_imuOffsets.gyroX = (int16_t)lroundf(g_calibration.gyroOffset[0] * gyroLsb);
+    g_imuOffsets.gyroY = (int16_t)lroundf(g_calibration.gyroOffset[1] * gyroLsb);
+    g_imuOffsets.gyroZ = (int16_t)lroundf(g_calibration.gyroOffset[2] * gyroLsb);
+}
+
+static inline int16_t subSat16(int16_t value, int16_t offset) {
+    int32_t d = (int32_t)value - offset;
+    return (int16_t)constrain(d, (int32_t)INT16_MIN, (int32_t)INT16_MAX);
+}
+
+// Raw LSB minus calibration offsets
+ImuRawSample applyImuOffsets(const ImuRawSample& raw) {
+    ImuRawSample out;
+    out.accX  = subSat16(raw.accX,  g_imuOffsets.accX);
+    out.accY  = subSat16(raw.accY,  g_imuOffsets.accY);
+    out.accZ  = subSat16(raw.accZ,  g_imuOffsets.accZ);
+    out.gyroX = subSat16(raw.gyroX, g_imuOffsets.gyroX);
+    out.gyroY = subSat16(raw.gyroY, g_imuOffsets.gyroY);
+    out.gyroZ = subSat16(raw.gyroZ, g_imuOffsets.gyroZ);
+    return out;
+}
+
+// Offset-corrected LSB: any axis rotating faster than limit
+static inline bool isRotating(const ImuRawSample& lsb, int32_t limit) {
+    return abs(lsb.gyroX) > limit || abs(lsb.gyroY) > limit || abs(lsb.gyroZ) > limit;
+}
+
+// Offset-corrected LSB → packet units (m/s² × ACCEL_SCALE, °/s × GYRO_SCALE)
+// for the active ranges (see sample_scale.h): the FPU runs the float
+// reference, the C3 the fixed-point factors
+SampleRecord toSampleRecord(const ImuRawSample& lsb) {
+    if constexpr (Board::hasFpu) {
+        return scaleSampleFloat(lsb, g_config.accelRange, g_config.gyroRange);
+    } else {
+        return scaleSample(lsb, g_config.accelRange, g_config.gyroRange);
+    }
+}
+
+// Offset-corrected LSB as they go into a v2 frame (FRAME_FORMAT_LSB)
+static inline SampleRecord toLsbRecord(const ImuRawSample& lsb) {
+    return {lsb.accX, lsb.accY, lsb.accZ, lsb.gyroX, lsb.gyroY, lsb.gyroZ};
+}
+
+// ─── Orientation Fusion ──────────────────────────────────────────────────────
+// Acquisition side: ranges and sample spacing of the active configuration
+void configureFusion() {
+#if FUSION_ENABLED
+    g_fusion.configure(g_config.accelRange, g_config.gyroRange, g_profile->periodUs);
+#endif
+}
+
+// Advance the attitude by one offset-corrected sample; record is the same
+// sample in packet units
+FusionRecord fuseSample(const ImuRawSample& lsb, const SampleRecord& record) {
+#if FUSION_ENABLED
+    g_fusion.update(lsb);
+    return g_fusion.output(record);
+#else
+    return {};
+#endif
+}
+
+// ─── Adaptive Rate ───────────────────────────────────────────────────────────
+// Acquisition side: samples are being captured in the idle tier
+inline bool rateIdle() {
+#if ADAPTIVE_RATE_ENABLED
+    return g_rateIdle;
+#else
+    return false;
+#endif
+}
+
+#if ADAPTIVE_RATE_ENABLED
+// Acquisition side: switch tier, moving INT between data-ready and the
+// motion interrupt. Waking restarts the stillness window, so the tier only
+// drops again after a fresh ADAPTIVE_IDLE_MS.
+void setRateTier(bool idle) {
+    if (!imuSelectMotionInterrupt(idle) && idle) {
+        return;  // Nothing would wake it: stay at full rate
+    }
+    g_rateIdle = idle;
+    if (!idle) {
+        g_idleWindow.clear();
+    }
+    statusLog("Rate: %s\n", idle ? "idle tier" : "full rate");
+}
+
+// Capture restart: full rate, and the motion detector set up again for
+// ranges that may have changed
+void resetRateTier() {
+    imuConfigureMotion(ADAPTIVE_WAKE_MG, ADAPTIVE_WAKE_DURATION);
+    if (g_rateIdle) {
+        setRateTier(false);
+    }
+    g_idleWindow.clear();
+}
+
+// Motion the MPU flagged since the last drain restores full rate for that
+// whole drain, so the sample that tripped it goes out at full rate
+void checkMotionWake() {
+    if (g_rateIdle && imuMotionDetected()) {
+        setRateTier(false);
+    }
+}
+
+// Per sample: rotation (the motion detector only sees acceleration)
+// restores full rate from this sample on; a window that stays still, and
+// below that rotation, for ADAPTIVE_IDLE_MS drops to the idle tier
+void trackRateTier(const ImuRawSample& lsb, const SampleRecord& record, uint32_t timestamp,
+                   int32_t wakeRotation) {
+    g_idleWindow.add(record);
+    if (g_rateIdle) {
+        if (isRotating(lsb, wakeRotation)) {
+            setRateTier(false);
+        }
+        return;
+    }
+    if (!g_idleWindow.still() || isRotating(lsb, wakeRotation)) {
+        g_stillSince = timestamp;
+    } else if (timestamp - g_stillSince >= ADAPTIVE_IDLE_MS * 1000UL) {
+        setRateTier(true);
+    }
+}
+#endif
+
+// ─── IMU Calibration ─────────────────────────────────────────────────────────
+// Block until the glove has been held still for STILLNESS_WINDOW_MS, by the
+// same rule the server calibrates with (stillness.h)
+void waitForStillness() {
+    GravityCapture stillness;
+    ImuRawSample raw;
+    for (;;) {
+        delay(g_profile->periodMs);
+        if (imuReadRaw(raw) && stillness.update(toSampleRecord(raw), sampleClockUs())) {
+            return;
+        }
+    }
+}
+
+// Blocking first-boot calibration: offsets from the library, then the gravity
+// reference while the device is still
+void calibrateImu() {
+    Serial.println("MPU6050: Calibrating - hold the glove still...");
+    
+    // Slow blink until it settles
+    ledSet(LED_PATTERN_SLOW);
+    waitForStillness();
+    
+    // Calibrate offsets (accelerometer and gyroscope)
+    mpu.calcOffsets(true, true);
+    g_calibration.version = IMU_CALIBRATION_VERSION;
+    g_calibration.accOffset[0] = mpu.getAccXoffset();
+    g_calibration.accOffset[1] = mpu.getAccYoffset();
+    g_calibration.accOffset[2] = mpu.getAccZoffset();
+    g_calibration.gyroOffset[0] = mpu.getGyroXoffset();
+    g_calibration.gyroOffset[1] = mpu.getGyroYoffset();
+    g_calibration.gyroOffset[2] = mpu.getGyroZoffset();
+    captureImuOffsets();
+    
+    int32_t sum[3] = {0, 0, 0};
+    ImuRawSample raw;
+    for (int i = 0; i < GRAVITY_CAPTURE_SAMPLES; i++) {
+        if (imuReadRaw(raw)) {
+            raw = applyImuOffsets(raw);
+            sum[0] += raw.accX;
+            sum[1] += raw.accY;
+            sum[2] += raw.accZ;
+        }
+        delay(2);
+    }
+    const float lsbToMs2 = GRAVITY_MS2 /
+        (ACCEL_LSB_PER_G[g_config.accelRange] * GRAVITY_CAPTURE_SAMPLES);
+    for (int axis = 0; axis < 3; axis++) {
+        g_calibration.gravity[axis] = sum[axis] * lsbToMs2;
+    }
+    Serial.println("MPU6050: Calibration complete");
+    
+#if CAL_PERSIST_ENABLED
+    if (!calibrationSave(g_calibration)) {
+        Serial.println("MPU6050: Could not save calibration, it will rerun next boot");
+    }
+#endif
+    
+    // Quick triple blink to indicate ready
+    ledFlash(LED_PATTERN_TRIPLE);
+}
+
+#if CAL_PERSIST_ENABLED
+// Stillness/drift thresholds in LSB for the active profile and ranges
+void resetDriftMonitor() {
+    const float accelLsb = ACCEL_LSB_PER_G[g_config.accelRange];
+    const float gyroLsb = GYRO_LSB_PER_DPS[g_config.gyroRange];
+    g_driftMonitor.reset(CAL_DRIFT_WINDOW_MS * 1000UL / g_profile->periodUs,
+                         lroundf(CAL_STILL_GYRO_DPS * gyroLsb),
+                         lroundf(CAL_STILL_ACCEL_G * accelLsb),
+                         lroundf(CAL_DRIFT_GYRO_DPS * gyroLsb));
+}
+
+// Acquisition side, offset-corrected LSB: when a still window shows gyro
+// drift, fold the residual bias into the offsets (from the next sample on)
+// and take the window's mean as the new gravity reference. The sender picks
+// up the gravity, loop() saves the record.
+void trackDrift(const ImuRawSample& lsb) {
+    if (!g_driftMonitor.update(lsb)) return;
+    
+    const float gyroLsb = GYRO_LSB_PER_DPS[g_config.gyroRange];
+    const float lsbToMs2 = GRAVITY_MS2 / ACCEL_LSB_PER_G[g_config.accelRange];
+    for (int axis = 0; axis < 3; axis++) {
+        g_calibration.gyroOffset[axis] += g_driftMonitor.gyroMean()[axis] / gyroLsb;
+        g_calibration.gravity[axis] = g_driftMonitor.accelMean()[axis] * lsbToMs2;
+    }
+    captureImuOffsets();
+#if FUSION_ENABLED
+    g_fusion.setGravity(g_calibration.gravity);
+#endif
+    xQueueOverwrite(g_gravityQueue, g_calibration.gravity);
+    xQueueOverwrite(g_calibrationQueue, &g_calibration);
+}
+
+// Transmission side: switch the punch detector to a refreshed reference
+void takeGravity() {
+    float gravity[3];
+    if (xQueueReceive(g_gravityQueue, gravity, 0) != pdTRUE) return;
+    
+    g_punchDetector.setGravity(gravity[0], gravity[1], gravity[2]);
+}
+
+// loop(): persist a background correction, keeping the flash write off the
+// acquisition task
+void saveCalibrationUpdate() {
+    ImuCalibration cal;
+    if (xQueueReceive(g_calibrationQueue, &cal, 0) != pdTRUE) return;
+    
+    bool saved = calibrationSave(cal);
+    statusLog("MPU6050: Gyro drift corrected, offsets %.2f/%.2f/%.2f°/s%s\n",
+              cal.gyroOffset[0], cal.gyroOffset[1], cal.gyroOffset[2],
+              saved ? "" : " (not saved)");
+}
+#endif
+
+// ─── MPU6050 Setup ───────────────────────────────────────────────────────────
+// Bus and sensor only, so the charging check can arm motion wake right away
+bool beginMPU() {
+    Serial.println("MPU6050: Initializing...");
+    
+    Wire.begin(Board::pinSda, Board::pinScl);
+    Wire.setClock(I2C_CLOCK_HZ);
+    
+    byte status = mpu.begin();
+    if (status != 0) {
+        Serial.printf("MPU6050: Init failed with status %d\n", status);
+        return false;
+    }
+    imuAttach(Wire, mpu.getAddress());
+#if SLEEP_ENABLED
+    imuDisableMotionWake();
+#endif
+    return true;
+}
+
+bool setupMPU() {
+    // Full-scale ranges before calibration so the offsets match them
+    mpu.setAccConfig(g_config.accelRange);
+    mpu.setGyroConfig(g_config.gyroRange);
+    
+    // A kept calibration makes the glove ready without a stillness wait
+    bool restored = false;
+    const char* source = "NVS";
+#if SLEEP_ENABLED
+    if (g_resumed && g_rtcState.calibrated) {
+        g_calibration = g_rtcState.calibration;
+        restored = true;
+        source = "RTC memory";
+    }
+#endif
+#if CAL_PERSIST_ENABLED
+    if (!restored) {
+        restored = calibrationLoad(g_calibration);
+    }
+    resetDriftMonitor();
+#endif
+    if (restored) {
+        captureImuOffsets();
+        Serial.printf("MPU6050: Ready, calibration restored from %s\n", source);
+    } else {
+        calibrateImu();
+    }
+    g_isCalibrated = true;
+    
+    // Gravity reference for on-glove punch detection
+    g_punchDetector.setGravity(g_calibration.gravity[0], g_calibration.gravity[1],
+                               g_calibration.gravity[2]);
+    Serial.printf("MPU6050: Gravity reference %s, up axis %c\n",
+                  restored ? "restored" : "captured", "XYZ"[g_punchDetector.upAxis()]);
+    
+    // The filter starts level on that reference and tracks from there
+    configureFusion();
+#if FUSION_ENABLED
+    g_fusion.reset(g_calibration.gravity);
+#endif
+    
+#if IMU_FIFO_ENABLED
+    // Hand sampling over to the sensor clock
+    if (!imuSetRate(g_profile->sampleRateDiv, g_profile->dlpfCfg) || !imuFifoBegin()) {
+        Serial.println("MPU6050: FIFO configuration failed");
+        return false;
+    }
+    Serial.printf("MPU6050: FIFO capture at %dHz, DLPF %dHz\n",
+                  g_profile->rateHz, g_profile->dlpfHz);
+#endif
+    Serial.printf("MPU6050: Range ±%dg, ±%d°/s%s\n",
+                  2 << g_config.accelRange, 250 << g_config.gyroRange,
+                  Board::hasFpu || ACCEL_SCALE_FACTORS[g_config.accelRange].exact
+                      ? "" : " (nearest fixed-point factor)");
+    
+#if IMU_INTERRUPT_ENABLED
+    // setup() and loop() share the Arduino loop task; the pipeline's
+    // acquisition task takes over once it starts
+    g_imuTask = xTaskGetCurrentTaskHandle();
+    pinMode(Board::pinImuInt, INPUT);
+    attachInterrupt(digitalPinToInterrupt(Board::pinImuInt), onImuDataReady, RISING);
+    if (!imuEnableDataReadyInterrupt()) {
+        Serial.println("MPU6050: Data-ready interrupt configuration failed");
+        return false;
+    }
+    Serial.printf("MPU6050: Data-ready interrupt on GPIO%d\n", Board::pinImuInt);
+#endif
+    
+    return true;
+}
+
+// ─── Send Sensor Data ────────────────────────────────────────────────────────
+uint8_t packetFlags() {
+    uint8_t flags = 0;
+    if (powerIsCharging()) {
+        flags |= FLAG_CHARGING;
+    }
+    if (g_isCalibrated) {
+        flags |= FLAG_CALIBRATED;
+    }
+#if ADAPTIVE_RATE_ENABLED
+    if (g_idleTier) {
+        flags |= FLAG_IDLE;
+    }
+#endif
+    return flags;
+}
+
+// setValue() + notify(), timed as one notify stage (NimBLE: notify() from
+// the caller's buffer; broadcast: advertised; USB: written to the host)
+void notifyValue(BLECharacteristic* pChar, const uint8_t* data, size_t length) {
+    uint32_t start = diagCycles();
+#if DIAG_ENABLED
+    g_notifyCount++;
+    g_notifyBytes += length;
+#endif
+#if BROADCAST_ENABLED
+    if (pChar == g_pSensorChar) {
+        broadcastFrame(data, length);
+        diagStage(DIAG_STAGE_NOTIFY, start);
+        return;
+    }
+#elif USB_TRANSPORT_ENABLED
+    if (pChar == g_pSensorChar) {
+        usbSendFrame(data, length);
+        diagStage(DIAG_STAGE_NOTIFY, start);
+        return;
+    }
+#endif
+#if BLE_STACK == BLE_STACK_NIMBLE
+    pChar->notify(data, length);    // Straight into an mbuf; no stored value
+#else
+    pChar->setValue((uint8_t*)data, length);
+    pChar->notify();
+#endif
+    diagStage(DIAG_STAGE_NOTIFY, start);
+}
+
+// After every g_latencyEvery-th sensor frame: its timestamp as sent (first
+// sample or punch crossing), which the central matches it by, and when it
+// went to the stack (queuedTime, stamped by the caller just before
+// notifyValue())
+void traceLatency(uint32_t captureTime, uint32_t queuedTime) {
+    uint8_t every = g_latencyEvery;
+    if (every == 0 || ++g_latencyFrames < every) return;
+    g_latencyFrames = 0;
+    
+    LatencyTraceFrame trace;
+    trace.frameType = FRAME_TYPE_LATENCY;
+    trace.captureTime = captureTime;
+    trace.queuedTime = queuedTime;
+    notifyValue(g_pSensorChar, (uint8_t*)&trace, sizeof(LatencyTraceFrame));
+}
+
+// Send the pending batch as one notification
+void flushBatch() {
+    if (g_batcher.empty()) return;
+    
+    uint32_t start = diagCycles();
+    size_t length = g_batcher.finish(powerBatteryPercent(), packetFlags());
+    diagStage(DIAG_STAGE_BUILD, start);
+    uint32_t queued = sampleClockUs();
+    notifyValue(g_pSensorChar, g_batcher.data(), length);
+    traceLatency(g_batcher.firstTimestamp(), queued);  // The header timestamp, sent as is
+#if RESEND_ENABLED
+    g_resendBuffer.store(g_batcher.data(), length, g_batcher.firstSequence(), g_batcher.count());
+#endif
+    g_batcher.clear();
+}
+
+// Notify one punch record; PUNCH_TYPE_NONE sends a heartbeat
+void sendPunchEvent(uint8_t type, const PunchEvent& event) {
+    PunchEventPacket packet;
+    packet.frameType = FRAME_TYPE_PUNCH;
+    packet.punchType = type;
+    packet.count = g_punchDetector.count();
+    packet.peakForce = (uint16_t)constrain(event.peakForce * ACCEL_SCALE, 0.0f, 65535.0f);
+    packet.peakRotation = (uint16_t)constrain(event.peakRotation * GYRO_SCALE, 0.0f, 65535.0f);
+    packet.timestamp = type == PUNCH_TYPE_NONE ? sampleClockUs() : event.timestamp;
+    packet.battery = powerBatteryPercent();
+    packet.flags = packetFlags();
+    
+    uint32_t queued = sampleClockUs();
+    notifyValue(g_pSensorChar, (uint8_t*)&packet, sizeof(PunchEventPacket));
+    traceLatency(packet.timestamp, queued);
+    g_lastHeartbeatTime = millis();
+}
+
+// Feed the punch detector one sample in packet units. Returns true when a
+// punch window closes (PunchDetector::update()).
+bool updatePunchDetector(const SampleRecord& record, uint32_t timestamp) {
+    return g_punchDetector.update(record.accX / (float)ACCEL_SCALE,
+                                  record.accY / (float)ACCEL_SCALE,
+                                  record.accZ / (float)ACCEL_SCALE,
+                                  record.gyroX / (float)GYRO_SCALE,
+                                  record.gyroY / (float)GYRO_SCALE,
+                                  record.gyroZ / (float)GYRO_SCALE, timestamp);
+}
+
+#if PUNCH_FEATURES_ENABLED
+static inline uint16_t clampU16(float v) {
+    return (uint16_t)constrain(v, 0.0f, 65535.0f);
+}
+
+// Notify one punch with its features, or as a plain punch record when the
+// MTU is still too small for them
+void sendPunchFeatures(const PunchFeatures& features) {
+    if (g_peerMtu < sizeof(PunchFeaturePacket) + 3) {
+        PunchEvent event;
+        event.type = features.type;
+        event.peakForce = features.peakForce;
+        event.peakRotation = fabsf(features.peakGyro[2]);
+        event.timestamp = features.timestamp;
+        event.count = features.count;
+        sendPunchEvent(features.type, event);
+        return;
+    }
+    
+    PunchFeaturePacket packet;
+    packet.frameType = FRAME_TYPE_PUNCH_FEATURES;
+    packet.punchType = features.type;
+    packet.count = features.count;
+    packet.timestamp = features.timestamp;
+    packet.peakForce = clampU16(features.peakForce * ACCEL_SCALE);
+    packet.impulse = clampU16(features.impulse * 100.0f);
+    packet.peakGyroX = (int16_t)constrain(features.peakGyro[0] * GYRO_SCALE, -32768.0f, 32767.0f);
+    packet.peakGyroY = (int16_t)constrain(features.peakGyro[1] * GYRO_SCALE, -32768.0f, 32767.0f);
+    packet.peakGyroZ = (int16_t)constrain(features.peakGyro[2] * GYRO_SCALE, -32768.0f, 32767.0f);
+    packet.duration = clampU16(features.durationUs / 100.0f);
+    packet.retraction = clampU16(features.retractionUs / 100.0f);
+    packet.battery = powerBatteryPercent();
+    packet.flags = packetFlags();
+    
+    uint32_t queued = sampleClockUs();
+    notifyValue(g_pSensorChar, (uint8_t*)&packet, sizeof(PunchFeaturePacket));
+    traceLatency(packet.timestamp, queued);
+    g_lastHeartbeatTime = millis();
+}
+
+// Every sample goes through the feature window; a punch is reported once
+// the window after its crossing has closed, instead of at the end of the
+// detector's peak window
+void trackPunch(const SampleRecord& record, const FusionRecord& fusion, uint32_t timestamp) {
+    updatePunchDetector(record, timestamp);
+    
+    const int16_t gyro[3] = {record.gyroX, record.gyroY, record.gyroZ};
+#if FUSION_ENABLED
+    // Gravity along the tracked attitude, so rotation during the punch
+    // does not read as force
+    const int16_t linAcc[3] = {fusion.linAccX, fusion.linAccY, fusion.linAccZ};
+    const uint8_t upAxis = fusionUpAxis(fusion);
+#else
+    const float* gravity = g_punchDetector.gravity();
+    const int16_t linAcc[3] = {(int16_t)(record.accX - lroundf(gravity[0] * ACCEL_SCALE)),
+                               (int16_t)(record.accY - lroundf(gravity[1] * ACCEL_SCALE)),
+                               (int16_t)(record.accZ - lroundf(gravity[2] * ACCEL_SCALE))};
+    const uint8_t upAxis = g_punchDetector.upAxis();
+#endif
+    if (g_punchWindow.add(linAcc, gyro, timestamp)) {
+        sendPunchFeatures(g_punchWindow.features());
+    }
+    if (g_punchDetector.triggered()) {
+        g_punchWindow.trigger(g_punchDetector.count(), upAxis);
+    }
+}
+#endif
+
+// One sample in packet units (see toSampleRecord()) and in LSB, with its
+// fusion output, µs timestamp and rate tier
+void sendSample(const SampleRecord& record, const SampleRecord& lsb, const FusionRecord& fusion,
+                uint32_t timestamp, bool idle) {
+#if DIAG_ENABLED
+    // Held up between capture and here: a stall on the glove, not the radio
+    if ((int32_t)(sampleClockUs() - timestamp) > DIAG_LATE_MS * 1000) {
+        g_lateSamples++;
+    }
+#endif
+#if ADAPTIVE_RATE_ENABLED
+    // A tier change starts a new frame, so FLAG_IDLE holds for all of one
+    if (idle != g_idleTier) {
+        flushBatch();
+        g_idleTier = idle;
+        g_lastIdleSample = timestamp - ADAPTIVE_IDLE_PERIOD_MS * 1000UL;
+    }
+#endif
+    
+    if (g_streamConfig.mode == STREAM_MODE_EVENTS) {
+        // Event-only mode: detect on the glove (on the same values the
+        // server would see) and notify finished punches
+#if PUNCH_FEATURES_ENABLED
+        trackPunch(record, fusion, timestamp);
+#else
+        if (updatePunchDetector(record, timestamp)) {
+            sendPunchEvent(g_punchDetector.event().type, g_punchDetector.event());
+        }
+#endif
+        return;
+    }
+    
+#if ADAPTIVE_RATE_ENABLED
+    // Idle tier: one sample per ADAPTIVE_IDLE_PERIOD_MS, each its own frame
+    // (sequence stays contiguous)
+    if (idle) {
+        if (timestamp - g_lastIdleSample < ADAPTIVE_IDLE_PERIOD_MS * 1000UL) return;
+        g_lastIdleSample = timestamp;
+    }
+#endif
+    
+#if BATCH_ENABLED
+    // Batch when the MTU leaves room for at least two records
+    bool streaming = g_streamConfig.mode == STREAM_MODE_RAW || g_streamConfig.mode == STREAM_MODE_FUSED;
+    if (streaming && g_batcher.capacity() > 0) {
+        if (!g_batcher.continues(timestamp)) {
+            flushBatch();
+        }
+        if (g_batcher.empty()) {
+            g_batchStartTime = millis();
+        }
+        uint32_t start = diagCycles();
+        const SampleRecord& sample = g_batcher.versioned() ? lsb : record;
+        if (g_batcher.fused()) {
+            g_batcher.append(sample, fusion, timestamp, g_sequenceNumber++);
+        } else {
+            g_batcher.append(sample, timestamp, g_sequenceNumber++);
+        }
+        diagStage(DIAG_STAGE_BUILD, start);
+        if (g_batcher.full()) {
+            flushBatch();
+        }
+        return;
+    }
+#endif
+    
+    // Single-sample packets can't carry more than ~100Hz: until a larger MTU
+    // is negotiated, send every Nth sample (sequence stays contiguous)
+    static uint8_t skipped = 0;
+    uint8_t decimation = max(1, LEGACY_PACKET_MS / g_streamProfile->periodMs);
+    if (++skipped < decimation) return;
+    skipped = 0;
+    
+    // Single-sample packet
+    uint32_t start = diagCycles();
+    uint32_t sequence = g_sequenceNumber++;
+    SensorPacket packet = makeSensorPacket(record, timestamp, sequence,
+                                           powerBatteryPercent(), packetFlags());
+    diagStage(DIAG_STAGE_BUILD, start);
+    
+    // Send via BLE notification
+    uint32_t queued = sampleClockUs();
+    notifyValue(g_pSensorChar, (uint8_t*)&packet, sizeof(SensorPacket));
+    traceLatency(timestamp, queued);
+#if RESEND_ENABLED
+    g_resendBuffer.store((uint8_t*)&packet, sizeof(SensorPacket), sequence, 1);
+#endif
+}
+
+#if IMU_FIFO_ENABLED
+#if IMU_INTERRUPT_ENABLED
+// One ISR stamp per FIFO record, aligned on the newest. Surplus stamps belong
+// to records lost in a FIFO reset; missing ones are back-filled at the ODR.
+void sampleTimestamps(uint32_t* out, uint16_t count) {
+    int64_t us;
+    while (g_stampRing.size() > count) {
+        g_stampRing.pop(us);
+    }
+    uint16_t have = min((uint16_t)g_stampRing.size(), count);
+    uint16_t missing = count - have;
+    for (uint16_t i = missing; i < count; i++) {
+        g_stampRing.pop(us);
+        out[i] = (uint32_t)us;
+    }
+    uint32_t period = g_profile->periodUs;
+    uint32_t next = have > 0 ? out[missing] : sampleClockUs() + period;
+    for (uint16_t i = 0; i < missing; i++) {
+        out[i] = next - (uint32_t)(missing - i) * period;
+    }
+}
+
+// At high rates, let a few samples collect so each wake is one FIFO burst;
+// a timed-out wait drains whatever is there
+bool drainDue(uint32_t notified) {
+    return notified == 0 || g_stampRing.size() >= g_profile->drainSamples || rateIdle();
+}
+
+// Stamped samples to drain, or, in the idle tier (no data-ready stamps),
+// whatever the FIFO collected since the last wake
+bool samplesPending() {
+    return !g_stampRing.empty() || rateIdle();
+}
+#else
+// Records are spaced by the sensor ODR, so keep one continuous sample clock
+// across drains. The newest record was captured within the last period;
+// re-anchor to the drain time if the clock drifts outside that.
+void sampleTimestamps(uint32_t* out, uint16_t count) {
+    static uint32_t lastOverflows = 0;
+    uint32_t now = sampleClockUs();
+    int32_t period = g_profile->periodUs;
+    uint32_t newest = g_lastSampleStamp + (uint32_t)count * period;
+    int32_t drift = (int32_t)(now - newest);
+    if (!g_sampleClockValid || imuFifoStats().overflows != lastOverflows ||
+        drift < -period || drift > 2 * period) {
+        newest = now;
+        lastOverflows = imuFifoStats().overflows;
+        g_sampleClockValid = true;
+    }
+    g_lastSampleStamp = newest;
+    
+    for (uint16_t i = 0; i < count; i++) {
+        out[i] = newest - (uint32_t)(count - 1 - i) * period;
+    }
+}
+#endif
+
+// Drain everything the sensor captured and queue it with capture times
+void acquireSamples() {
+    static ImuRawSample raw[IMU_FIFO_MAX_DRAIN];
+    diagWake();
+    uint32_t start = diagCycles();
+    uint16_t count = imuFifoRead(raw, IMU_FIFO_MAX_DRAIN);
+    start = diagStage(DIAG_STAGE_I2C, start);
+    if (count == 0) return;
+    
+    uint32_t stamps[IMU_FIFO_MAX_DRAIN];
+    sampleTimestamps(stamps, count);
+#if ADAPTIVE_RATE_ENABLED
+    checkMotionWake();
+    const int32_t wakeRotation = lroundf(ADAPTIVE_WAKE_GYRO_DPS * GYRO_LSB_PER_DPS[g_config.gyroRange]);
+#endif
+    
+#if SLEEP_ENABLED
+    // Rotation keeps the glove awake (see checkIdleSleep())
+    const int32_t rotation = lroundf(SLEEP_MOTION_GYRO_DPS * GYRO_LSB_PER_DPS[g_config.gyroRange]);
+    bool active = false;
+#endif
+    for (uint16_t i = 0; i < count; i++) {
+        ImuRawSample lsb = applyImuOffsets(raw[i]);
+#if CAL_PERSIST_ENABLED
+        trackDrift(lsb);
+#endif
+#if SLEEP_ENABLED
+        active |= isRotating(lsb, rotation);
+#endif
+        // Dropped samples show as sequence gaps
+        SampleRecord record = toSampleRecord(lsb);
+#if ADAPTIVE_RATE_ENABLED
+        trackRateTier(lsb, record, stamps[i], wakeRotation);
+#endif
+        g_sampleRing.push({stamps[i], record, toLsbRecord(lsb), fuseSample(lsb, record), rateIdle()});
+    }
+    diagStage(DIAG_STAGE_CONVERT, start);
+#if SLEEP_ENABLED
+    if (active) {
+        g_lastActivityTime = millis();
+    }
+#endif
+}
+
+void sendSensorData() {
+    TimedRecord sample;
+    while (g_sampleRing.pop(sample)) {
+        sendSample(sample.record, sample.lsb, sample.fusion, sample.timestamp, sample.idle);
+    }
+}
+#else
+void sendSensorData() {
+    // One burst read of the output registers per tick
+    ImuRawSample raw;
+    diagWake();
+    uint32_t start = diagCycles();
+    bool read = imuReadRaw(raw);
+    start = diagStage(DIAG_STAGE_I2C, start);
+    if (!read) return;
+    
+    ImuRawSample lsb = applyImuOffsets(raw);
+#if CAL_PERSIST_ENABLED
+    trackDrift(lsb);
+#endif
+#if SLEEP_ENABLED
+    if (isRotating(lsb, lroundf(SLEEP_MOTION_GYRO_DPS * GYRO_LSB_PER_DPS[g_config.gyroRange]))) {
+        g_lastActivityTime = millis();
+    }
+#endif
+    SampleRecord record = toSampleRecord(lsb);
+    FusionRecord fusion = fuseSample(lsb, record);
+    diagStage(DIAG_STAGE_CONVERT, start);
+    sendSample(record, toLsbRecord(lsb), fusion, sampleClockUs(), false);
+}
+#endif
+
+// ─── Disconnect Log ──────────────────────────────────────────────────────────
+#if SAMPLE_LOG_ENABLED
+// Logged frames are always full-size delta batches: they are replayed on a
+// link that has to grant the largest MTU anyway
+void flushLogBatch() {
+    if (g_logBatcher.empty()) return;
+    
+    // Logged at the full rate whatever the live tier was
+    size_t length = g_logBatcher.finish(powerBatteryPercent(), packetFlags() & ~FLAG_IDLE);
+    g_sampleLog.append(g_logBatcher.data(), length);
+    g_logBatcher.clear();
+}
+
+// Link lost mid-session (or the profile changed while logging): keep
+// sampling into flash. Sequence numbers carry on from the live stream.
+void startLogging() {
+    if (!g_sampleLog.ready()) return;
+    
+    flushLogBatch();
+    g_logBatcher.setMtu(BATCH_MAX_PAYLOAD + 3);
+    g_logBatcher.setInterval(g_streamProfile->periodUs);
+    if (!g_logging) {
+        statusLog("Log: Link lost, logging samples to flash\n");
+    }
+    g_logging = true;
+}
+
+void logSample(const SampleRecord& record, uint32_t timestamp) {
+    if (!g_logBatcher.continues(timestamp)) {
+        flushLogBatch();
+    }
+    g_logBatcher.append(record, timestamp, g_sequenceNumber++);
+    if (g_logBatcher.full()) {
+        flushLogBatch();
+    }
+}
+
+void logSensorData() {
+    TimedRecord sample;
+    while (g_sampleRing.pop(sample)) {
+        logSample(sample.record, sample.timestamp);
+    }
+}
+
+// Reconnected: close the log; serviceBackfill() replays it from here
+void stopLogging() {
+    if (!g_logging) return;
+    
+    logSensorData();
+    flushLogBatch();
+    g_logging = false;
+    g_backfillFrames = 0;
+    const SampleLogStats& stats = g_sampleLog.stats();
+    statusLog("Log: %u frames to backfill (%u dropped, %u write errors)\n",
+              (unsigned)g_sampleLog.pending(), (unsigned)stats.framesDropped,
+              (unsigned)stats.writeErrors);
+}
+
+// Replay a few logged frames per wake so the live stream keeps its share of
+// the link. An empty delta batch (count 0) marks the end of the backlog.
+void serviceBackfill() {
+    if (g_logging || (g_backfillFrames == 0 && g_sampleLog.empty())) return;
+    if (g_peerMtu < BATCH_MAX_PAYLOAD + 3 || !bulkSubscribed()) return;
+    
+    static uint8_t frame[SAMPLE_LOG_MAX_FRAME];
+    for (int i = 0; i < BACKFILL_BURST; i++) {
+        size_t length = g_sampleLog.pop(frame);
+        if (length == 0) {
+            BatchHeader end = {};
+            end.frameType = FRAME_TYPE_DELTA;
+            end.sequence = g_sequenceNumber;
+            end.timestamp = sampleClockUs();
+            end.battery = powerBatteryPercent();
+            end.flags = packetFlags();
+            notifyValue(g_pBulkChar, (uint8_t*)&end, sizeof(BatchHeader));
+            statusLog("Log: Backfill complete, %u frames\n", (unsigned)g_backfillFrames);
+            g_backfillFrames = 0;
+            return;
+        }
+        notifyValue(g_pBulkChar, frame, length);
+        g_backfillFrames++;
+    }
+}
+#endif
+
+// ─── Loss Recovery ───────────────────────────────────────────────────────────
+#if RESEND_ENABLED
+// Resend the frames a NACK asked for, a few per wake, on the bulk
+// characteristic. Frames are resent whole and unchanged.
+void serviceResend() {
+    if ((int32_t)(g_resendEnd - g_resendNext) <= 0) {
+        ResendRequest request;
+        if (xQueueReceive(g_resendQueue, &request, 0) != pdTRUE) return;
+        g_resendNext = request.sequence;
+        g_resendEnd = request.sequence + request.count;
+    }
+    if (!bulkSubscribed()) {
+        g_resendNext = g_resendEnd;
+        return;
+    }
+    
+    static uint8_t frame[RESEND_MAX_FRAME];
+    for (int i = 0; i < RESEND_BURST && (int32_t)(g_resendEnd - g_resendNext) > 0; i++) {
+        size_t length = g_resendBuffer.find(g_resendNext, g_resendEnd, frame, g_resendNext);
+        if (length == 0) {
+            // Older than the buffer reaches (or never sent)
+            g_resendNext = g_resendEnd;
+            return;
+        }
+        notifyValue(g_pBulkChar, frame, length);
+    }
+}
+#endif
+
+// Samples are still wanted while advertising if the disconnect log is open
+static inline bool sampleConsumerActive() {
+#if SAMPLE_LOG_ENABLED
+    return g_logging;
+#else
+    return false;
+#endif
+}
+
+// ─── Diagnostics ─────────────────────────────────────────────────────────────
+#if DIAG_ENABLED
+// Transmission side: close the window, notify it and dump it to Serial
+void publishDiagnostics(uint32_t now) {
+    DiagnosticsStatus status = {};
+    status.uptime = now;
+    status.cpuMhz = ESP.getCpuFreqMHz();
+    status.window = (uint16_t)min(now - g_lastDiagTime, (uint32_t)UINT16_MAX);
+    uint32_t mean[DIAG_STAGE_COUNT], peak[DIAG_STAGE_COUNT];
+    for (int i = 0; i < DIAG_STAGE_COUNT; i++) {
+        g_stageTimers[i].take(mean[i], peak[i]);
+        status.stageMean[i] = mean[i];
+        status.stageMax[i] = peak[i];
+    }
+    uint16_t jitter[DIAG_JITTER_BUCKETS];
+    g_wakeJitter.take(jitter);
+    memcpy((uint8_t*)status.jitter, jitter, sizeof(jitter));
+#if IMU_FIFO_ENABLED
+    status.dropped = g_sampleRing.overruns();
+    status.fifoResets = imuFifoStats().overflows;
+#endif
+    status.late = g_lateSamples;
+    status.notifyFailures = g_notifyFailures;
+    status.heapFree = ESP.getFreeHeap();
+    status.heapMin = ESP.getMinFreeHeap();
+    g_lastDiagTime = now;
+    
+    // Always readable; notified once the MTU fits it
+    g_pDiagChar->setValue((uint8_t*)&status, sizeof(DiagnosticsStatus));
+    if (g_peerMtu >= sizeof(DiagnosticsStatus) + 3) {
+        g_pDiagChar->notify();
+    }
+    
+    const float mhz = status.cpuMhz;
+    statusLog("Diag: µs mean/peak i2c %.1f/%.1f, convert %.1f/%.1f, build %.1f/%.1f, "
+              "notify %.1f/%.1f\n",
+              mean[DIAG_STAGE_I2C] / mhz, peak[DIAG_STAGE_I2C] / mhz,
+              mean[DIAG_STAGE_CONVERT] / mhz, peak[DIAG_STAGE_CONVERT] / mhz,
+              mean[DIAG_STAGE_BUILD] / mhz, peak[DIAG_STAGE_BUILD] / mhz,
+              mean[DIAG_STAGE_NOTIFY] / mhz, peak[DIAG_STAGE_NOTIFY] / mhz);
+    statusLog("Diag: wake jitter <32µs..≥2ms %u %u %u %u %u %u %u %u\n",
+              jitter[0], jitter[1], jitter[2], jitter[3],
+              jitter[4], jitter[5], jitter[6], jitter[7]);
+    statusLog("Diag: dropped %u, FIFO resets %u, late %u, notify failures %u, "
+              "heap %uKB (low %uKB)\n",
+              (unsigned)status.dropped, (unsigned)status.fifoResets,
+              (unsigned)status.late, (unsigned)status.notifyFailures,
+              (unsigned)(status.heapFree / 1024), (unsigned)(status.heapMin / 1024));
+    if (status.window > 0) {
+        statusLog("Diag: " BLE_STACK_NAME " %u notifications/s, %uB/s\n",
+                  (unsigned)(g_notifyCount * 1000 / status.window),
+                  (unsigned)((uint64_t)g_notifyBytes * 1000 / status.window));
+    }
+    g_notifyCount = 0;
+    g_notifyBytes = 0;
+#if USB_TRANSPORT_ENABLED
+    statusLog("Diag: USB %u frames dropped, %u rejected from host\n",
+              (unsigned)g_usbDropped, (unsigned)g_usbReader.rejected());
+#endif
+}
+#endif
+
+// ─── Stream Control ──────────────────────────────────────────────────────────
+#if IMU_FIFO_ENABLED
+// Acquisition side: drop whatever piled up while advertising
+void restartCapture() {
+    imuFifoReset();
+    g_sampleClockValid = false;
+#if DIAG_ENABLED
+    g_wakeJitter.restart();
+#endif
+#if IMU_INTERRUPT_ENABLED
+    g_stampRing.clear();
+#endif
+#if ADAPTIVE_RATE_ENABLED
+    resetRateTier();
+#endif
+}
+#endif
+
+// Acquisition side: switch to a configuration written by the central. Runs
+// where the I2C bus is owned (acquisition task, or loop() without the
+// pipeline); returns true when the transmission side has to restart.
+bool takeStreamConfig() {
+    StreamConfig config;
+    if (xQueueReceive(g_controlQueue, &config, 0) != pdTRUE) return false;
+    
+    bool rangesChanged = config.accelRange != g_config.accelRange ||
+                         config.gyroRange != g_config.gyroRange;
+    g_config = config;
+    g_profile = &rateProfile(config.profile);
+    if (rangesChanged) {
+        mpu.setAccConfig(config.accelRange);
+        mpu.setGyroConfig(config.gyroRange);
+        captureImuOffsets();  // Stored offsets are kept in g and °/s
+    }
+#if IMU_FIFO_ENABLED
+    imuSetRate(g_profile->sampleRateDiv, g_profile->dlpfCfg);
+    restartCapture();
+#endif
+#if CAL_PERSIST_ENABLED
+    resetDriftMonitor();
+#endif
+    configureFusion();
+    
+    g_pControlChar->setValue((uint8_t*)&g_config, sizeof(StreamConfig));
+    if (g_deviceConnected) {
+        g_pControlChar->notify();
+    }
+    static const char* const modeNames[] = {"raw", "events", "single", "fused"};
+    statusLog("Control: %dHz %s, %s encoding, ±%dg, ±%d°/s, %s\n",
+              g_profile->rateHz, modeNames[config.mode],
+              config.encoding == ENCODING_DELTA ? "delta" : "raw",
+              2 << config.accelRange, 250 << config.gyroRange,
+              config.format == FRAME_FORMAT_LSB ? "LSB" : "packet units");
+    xQueueOverwrite(g_streamQueue, &config);
+    return true;
+}
+
+// Transmission side: adopt the configuration takeStreamConfig() handed over.
+// Until then the samples queued under the old one are sent with it.
+void takeStreamHandoff() {
+    if (xQueueReceive(g_streamQueue, &g_streamConfig, 0) == pdTRUE) {
+        g_streamProfile = &rateProfile(g_streamConfig.profile);
+    }
+}
+
+// Transmission side: start the new connection (or configuration) with empty
+// queues, under the configuration last handed over. Above 100Hz the batcher needs at least the profile's encoding to
+// fit on air. While the disconnect log is open it takes the new profile
+// instead. Either way nothing sent before can be resent.
+void restartStream() {
+    takeStreamHandoff();
+#if RESEND_ENABLED
+    // The central only NACKs gaps within one stream
+    g_resendBuffer.clear();
+    xQueueReset(g_resendQueue);
+    g_resendNext = g_resendEnd;
+#endif
+#if SAMPLE_LOG_ENABLED
+    if (g_logging) {
+        startLogging();
+        return;
+    }
+#endif
+#if IMU_FIFO_ENABLED
+    g_sampleRing.clear();
+#elif DIAG_ENABLED
+    g_wakeJitter.restart();     // Sampling restarts with the stream
+#endif
+    g_batcher.setInterval(g_streamProfile->periodUs);
+    g_batcher.setEncoding(max((BatchEncoding)g_streamConfig.encoding, g_streamProfile->minEncoding));
+    g_batcher.setFused(g_streamConfig.mode == STREAM_MODE_FUSED);
+    if (g_streamConfig.format == FRAME_FORMAT_LSB) {
+        g_batcher.setScale((uint16_t)ACCEL_LSB_PER_G[g_streamConfig.accelRange],
+                           (uint16_t)lroundf(GYRO_LSB_PER_DPS[g_streamConfig.gyroRange] * 10));
+    } else {
+        g_batcher.setScale(0, 0);
+    }
+    g_batchMtu = 0;
+}
+
+// Echo a pending clock-sync ping, stamped as it goes out
+void sendSyncEcho() {
+    SyncEcho echo;
+    if (xQueueReceive(g_syncQueue, &echo, 0) != pdTRUE) return;
+    
+    echo.txTime = sampleClockUs();
+    notifyValue(g_pSyncChar, (uint8_t*)&echo, sizeof(SyncEcho));
+}
+
+// Send queued samples plus any batch/heartbeat that is due
+void serviceStream() {
+    // Ahead of sample traffic: a late echo only widens the sync round trip
+    sendSyncEcho();
+#if CAL_PERSIST_ENABLED
+    takeGravity();
+#endif
+    
+#if BATCH_ENABLED
+    // Resize batches once the MTU exchange completes
+    if (g_batchMtu != g_peerMtu) {
+        flushBatch();
+        g_batchMtu = g_peerMtu;
+        g_batcher.setMtu(g_batchMtu);
+        statusLog("BLE: Batching %s%s%s, at least %d samples per notification\n",
+                  g_batcher.encoding() == ENCODING_DELTA ? "delta" : "raw",
+                  g_batcher.fused() ? " fused" : "", g_batcher.versioned() ? " LSB" : "",
+                  g_batcher.capacity());
+    }
+#endif
+    
+#if IMU_FIFO_ENABLED
+    sendSensorData();
+#endif
+    
+    uint32_t now = millis();
+    
+#if BATCH_ENABLED
+    // Bound the latency a partial batch can add
+    if (!g_batcher.empty() && now - g_batchStartTime >= BATCH_MAX_LATENCY_MS) {
+        flushBatch();
+    }
+#endif
+    
+    // Keep battery/flags fresh and the link alive between punches
+    if (g_streamConfig.mode == STREAM_MODE_EVENTS && now - g_lastHeartbeatTime >= EVENT_HEARTBEAT_MS) {
+        sendPunchEvent(PUNCH_TYPE_NONE, PunchEvent());
+    }
+    
+#if RESEND_ENABLED
+    serviceResend();
+#endif
+#if SAMPLE_LOG_ENABLED
+    serviceBackfill();
+#endif
+#if DIAG_ENABLED
+    if (now - g_lastDiagTime >= DIAG_PERIOD_MS) {
+        publishDiagnostics(now);
+    }
+#endif
+}
+
+// ─── Sleep ───────────────────────────────────────────────────────────────────
+#if SLEEP_ENABLED
+// Boot: a wake from deep sleep finds the RTC state left by enterMotionSleep()
+bool restoreRtcState() {
+    g_resumed = esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_UNDEFINED &&
+                g_rtcState.magic == RTC_STATE_MAGIC;
+    if (!g_resumed) {
+        g_rtcState = {};
+        g_rtcState.magic = RTC_STATE_MAGIC;
+    }
+    return g_resumed;
+}
+
+// Owner of the I2C bus only: arm motion wake and power down. The glove comes
+// back through setup(); this never returns.
+void enterMotionSleep(const char* reason) {
+    Serial.printf("Sleep: %s, waking on motion\n", reason);
+    ledStop();
+    if (g_isCalibrated) {
+        g_rtcState.calibration = g_calibration;
+        g_rtcState.calibrated = true;
+    }
+    g_rtcState.sleeps++;
+    
+    if (imuEnableMotionWake(WAKE_MOTION_MG, WAKE_MOTION_DURATION, WAKE_CYCLE_RATE)) {
+#if SOC_GPIO_SUPPORT_DEEPSLEEP_WAKEUP
+        esp_deep_sleep_enable_gpio_wakeup(1ULL << Board::pinImuInt, ESP_GPIO_WAKEUP_GPIO_HIGH);
+#else
+        esp_sleep_enable_ext0_wakeup((gpio_num_t)Board::pinImuInt, 1);
+#endif
+    } else {
+        Serial.println("Sleep: Motion wake setup failed, waking on a timer");
+        esp_sleep_enable_timer_wakeup(WAKE_RETRY_S * 1000000ULL);
+    }
+    Serial.flush();
+    esp_deep_sleep_start();
+}
+
+// loop(): sleep once the glove has been idle long enough. Advertising with
+// nothing to log only waits for a central; otherwise the stream has to show
+// no rotation.
+void checkIdleSleep() {
+    bool advertising = !g_deviceConnected && !sampleConsumerActive();
+    uint32_t limit = advertising ? SLEEP_IDLE_MS : SLEEP_STILL_MS;
+    uint32_t last = g_lastActivityTime;
+    if (limit == 0 || millis() - last < limit) return;
+    
+    const char* reason = advertising ? "No central" : "No motion";
+#if PIPELINE_ENABLED
+    g_sleepReason = reason;     // The acquisition task owns the bus
+#else
+    enterMotionSleep(reason);
+#endif
+}
+#endif
+
+// ─── Task Pipeline ───────────────────────────────────────────────────────────
+#if PIPELINE_ENABLED
+// High priority: drain the FIFO as soon as samples land and hand them over
+void acquisitionTask(void* param) {
+#if !IMU_INTERRUPT_ENABLED
+    TickType_t lastWake = xTaskGetTickCount();
+#endif
+    for (;;) {
+#if IMU_INTERRUPT_ENABLED
+        uint32_t notified = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(IMU_WAKE_TIMEOUT_MS));
+#else
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(IMU_FIFO_DRAIN_MS));
+#endif
+#if SLEEP_ENABLED
+        if (g_sleepReason) {
+            enterMotionSleep(g_sleepReason);
+        }
+#endif
+        if (g_captureRestart) {
+            restartCapture();
+            g_captureRestart = false;
+        }
+        if (takeStreamConfig()) {
+            g_streamRestart = true;
+        }
+        if (!g_deviceConnected && !sampleConsumerActive()) {
+#if IMU_INTERRUPT_ENABLED
+            g_stampRing.clear();  // Nothing consumes samples while advertising
+#endif
+            continue;
+        }
+#if IMU_INTERRUPT_ENABLED
+        if (!drainDue(notified)) continue;
+#endif
+        
+        acquireSamples();
+        if (!g_sampleRing.empty()) {
+            xTaskNotifyGive(g_bleTask);
+        }
+    }
+}
+
+// Owns the batcher and every sensor-characteristic notification
+void bleTask(void* param) {
+    bool streaming = false;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(BLE_TASK_WAKE_MS));
+        if (!g_deviceConnected) {
+#if SAMPLE_LOG_ENABLED
+            if (streaming || (g_logging && g_streamRestart)) {
+                g_streamRestart = false;
+                takeStreamHandoff();
+                startLogging();
+            }
+            if (g_logging) {
+                logSensorData();
+            }
+#endif
+            streaming = false;
+            continue;
+        }
+        if (!streaming) {
+#if SAMPLE_LOG_ENABLED
+            // Logged samples continue the old stream; anything else starts fresh
+            if (g_logging) {
+                stopLogging();
+            } else {
+                g_captureRestart = true;
+            }
+#else
+            g_captureRestart = true;
+#endif
+        }
+        if (!streaming || g_streamRestart) {
+            g_streamRestart = false;
+            restartStream();
+            streaming = true;
+        }
+        serviceStream();
+    }
+}
+
+void startPipelineTask(TaskFunction_t fn, const char* name, uint32_t stack,
+                       UBaseType_t priority, BaseType_t core, TaskHandle_t* handle) {
+    if constexpr (Board::cores > 1) {
+        xTaskCreatePinnedToCore(fn, name, stack, nullptr, priority, handle, core);
+    } else {
+        // Single core: priorities alone keep acquisition ahead of BLE
+        (void)core;
+        xTaskCreate(fn, name, stack, nullptr, priority, handle);
+    }
+}
+
+void setupPipeline() {
+    // BLE task first so acquisition can notify it from its first drain
+    startPipelineTask(bleTask, "ble", BLE_TASK_STACK, BLE_TASK_PRIORITY,
+                      BLE_TASK_CORE, &g_bleTask);
+    startPipelineTask(acquisitionTask, "acq", ACQ_TASK_STACK, ACQ_TASK_PRIORITY,
+                      ACQ_TASK_CORE, &g_acqTask);
+#if IMU_INTERRUPT_ENABLED
+    g_imuTask = g_acqTask;
+#endif
+    if constexpr (Board::cores > 1) {
+        Serial.printf("Pipeline: acquisition on core %d, BLE on core %d\n",
+                      ACQ_TASK_CORE, BLE_TASK_CORE);
+    } else {
+        Serial.printf("Pipeline: acquisition prio %d, BLE prio %d\n",
+                      ACQ_TASK_PRIORITY, BLE_TASK_PRIORITY);
+    }
+}
+
+void printPipelineStats() {
+#if IMU_INTERRUPT_ENABLED
+    statusLog("Pipeline: queue %u/%u (peak %u), overruns %u, ISR stamps peak %u, overruns %u\n",
+              (unsigned)g_sampleRing.size(), (unsigned)g_sampleRing.capacity(),
+              (unsigned)g_sampleRing.highWater(), (unsigned)g_sampleRing.overruns(),
+              (unsigned)g_stampRing.highWater(), (unsigned)g_stampRing.overruns());
+#else
+    statusLog("Pipeline: queue %u/%u (peak %u), overruns %u\n",
+              (unsigned)g_sampleRing.size(), (unsigned)g_sampleRing.capacity(),
+              (unsigned)g_sampleRing.highWater(), (unsigned)g_sampleRing.overruns());
+#endif
+}
+#endif
+
+// ─── Update Link Status Characteristic ───────────────────────────────────────
+void publishLinkStatus() {
+    LinkStatus status = g_linkStatus;
+    g_pStatusChar->setValue((uint8_t*)&status, sizeof(LinkStatus));
+    g_pStatusChar->notify();
+    
+    statusLog("BLE: Link %u.%02ums interval, latency %u, timeout %ums, MTU %u, "
+              "DLE %u/%u, PHY %s\n",
+              status.interval * 125 / 100, status.interval * 125 % 100,
+              status.latency, status.timeout * 10, status.mtu,
+              status.txOctets, status.rxOctets, status.txPhy == LINK_PHY_2M ? "2M" : "1M");
+}
+
+// ─── Update Battery Characteristic ───────────────────────────────────────────
+void updateBattery() {
+    uint8_t level = powerBatteryPercent();
+    g_pBatteryChar->setValue(&level, 1);
+    g_pBatteryChar->notify();
+    
+    statusLog("Battery: %d%% (%dmV)%s\n", level, powerBatteryMillivolts(),
+              powerIsCharging() ? ", charging" : "");
+#if PIPELINE_ENABLED
+    printPipelineStats();
+#endif
+}
+
+// ─── Setup ───────────────────────────────────────────────────────────────────
+void fighterLinkSetup(uint8_t handId) {
+    g_handId = handId;
+#if USB_TRANSPORT_ENABLED
+    // Room for bursts while the host is busy; never block the sender on it
+    Serial.setTxBufferSize(USB_TX_BUFFER_BYTES);
+    Serial.setTxTimeoutMs(0);
+#endif
+    Serial.begin(115200);
+    delay(SERIAL_WAIT_MS);  // Optional wait for a serial monitor
+    
+    Serial.println("\n========================================");
+    Serial.println("FighterLink Boxing Glove Firmware");
+    Serial.printf("Board: %s\n", Board::name);
+    Serial.printf("Hand: %s\n", g_handId == HAND_LEFT ? "LEFT" : "RIGHT");
+    Serial.println("========================================\n");
+    
+#if SCALE_BENCHMARK
+    runScaleBenchmark();
+#endif
+#if SLEEP_ENABLED
+    if (restoreRtcState()) {
+        Serial.printf("Wake: Resuming after sleep %u\n", (unsigned)g_rtcState.sleeps);
+    }
+#endif
+    
+    // Initialize LED (timer-driven patterns) and the runtime status writer
+    ledBegin();
+    ledSet(LED_PATTERN_SLOW);
+    statusLogBegin();
+    
+    // Start background battery/charge sampling
+    powerMonitorBegin();
+    
+    // Initialize MPU6050 (bus first: a glove in the case sleeps right away)
+    bool imuReady = beginMPU();
+    
+    // Check if in charging case
+    if (powerIsCharging()) {
+        Serial.println("Charging detected - remove from case to activate");
+#if SLEEP_ENABLED
+        // Lifting the glove out wakes it; a bump in the case just sleeps again
+        if (imuReady) {
+            enterMotionSleep("Charging");
+        }
+#else
+        ledSet(LED_PATTERN_CHARGING);
+        while (powerIsCharging()) {
+            delay(100);
+        }
+        ledSet(LED_PATTERN_SLOW);
+#endif
+    }
+    
+    if (!imuReady || !setupMPU()) {
+        Serial.println("FATAL: MPU6050 initialization failed");
+        // Rapid blink to indicate error
+        ledSet(LED_PATTERN_ERROR);
+        while (true) {
+            delay(1000);
+        }
+    }
+    
+    // Initialize BLE (control writes and sync pings are handed over through
+    // one-slot queues, resend requests through a short one)
+    g_controlQueue = xQueueCreate(1, sizeof(StreamConfig));
+    g_streamQueue = xQueueCreate(1, sizeof(StreamConfig));
+    g_syncQueue = xQueueCreate(1, sizeof(SyncEcho));
+#if CAL_PERSIST_ENABLED
+    g_gravityQueue = xQueueCreate(1, sizeof(g_calibration.gravity));
+    g_calibrationQueue = xQueueCreate(1, sizeof(ImuCalibration));
+#endif
+#if RESEND_ENABLED
+    g_resendQueue = xQueueCreate(RESEND_QUEUE_DEPTH, sizeof(ResendRequest));
+#endif
+    setupBLE();
+    
+#if SAMPLE_LOG_ENABLED
+    if (g_sampleLog.begin(SAMPLE_LOG_PARTITION)) {
+        Serial.printf("Log: %uKB disconnect log ready\n",
+                      (unsigned)(g_sampleLog.capacityBytes() / 1024));
+    } else {
+        Serial.println("Log: No '" SAMPLE_LOG_PARTITION "' partition, disconnect log disabled");
+    }
+#endif
+    
+#if PIPELINE_ENABLED
+    setupPipeline();
+#endif
+    
+#if SLEEP_ENABLED
+    g_lastActivityTime = millis();
+#endif
+    ledSet(LED_PATTERN_FAST);
+    Serial.println("Setup complete - waiting for BLE connection...");
+}
+
+// ─── Main Loop ───────────────────────────────────────────────────────────────
+void fighterLinkLoop() {
+#if PIPELINE_ENABLED
+    // Sampling and BLE run in their own tasks; loop() only does housekeeping
+    vTaskDelay(pdMS_TO_TICKS(LOOP_IDLE_MS));
+#elif IMU_INTERRUPT_ENABLED
+    // Sleep until the next sample; the timeout keeps LED/battery housekeeping going
+    uint32_t notified = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(IMU_WAKE_TIMEOUT_MS));
+#endif
+    uint32_t now = millis();
+    
+#if USB_TRANSPORT_ENABLED
+    pollUsbControl();
+#endif
+#if !PIPELINE_ENABLED
+    if (takeStreamConfig()) {
+        restartStream();
+    }
+#endif
+#if CAL_PERSIST_ENABLED
+    saveCalibrationUpdate();
+#endif
+    
+    // Handle connection state changes
+    if (g_deviceConnected && !g_oldDeviceConnected) {
+        // Just connected
+        statusLog("Starting sensor streaming...\n");
+        ledSet(LED_PATTERN_ON);  // Solid LED when connected
+#if PIPELINE_ENABLED
+        // The BLE task restarts both sides on its own
+#else
+#if SAMPLE_LOG_ENABLED
+        if (g_logging) {
+            stopLogging();
+        } else {
+            restartCapture();
+        }
+#elif IMU_FIFO_ENABLED
+        restartCapture();
+#endif
+        restartStream();
+#endif
+#if SLEEP_ENABLED
+        g_lastActivityTime = now;
+#endif
+        g_oldDeviceConnected = true;
+    }
+    
+    if (!g_deviceConnected && g_oldDeviceConnected) {
+        // Just disconnected
+        statusLog("Connection lost - restarting advertising...\n");
+        ledSet(LED_PATTERN_FAST);
+        delay(500);  // Give BLE stack time to reset
+        g_pServer->startAdvertising();
+#if SAMPLE_LOG_ENABLED && !PIPELINE_ENABLED
+        startLogging();
+#endif
+#if SLEEP_ENABLED
+        g_lastActivityTime = millis();
+#endif
+        g_oldDeviceConnected = false;
+    }
+    
+    // When connected: stream sensor data at the profile rate
+    if (g_deviceConnected) {
+#if PIPELINE_ENABLED
+        // Handled by acquisitionTask() / bleTask()
+#elif IMU_INTERRUPT_ENABLED
+        // Woken by the data-ready ISR: drain as soon as a sample lands
+        if (samplesPending() && drainDue(notified)) {
+            acquireSamples();
+        }
+        serviceStream();
+#elif IMU_FIFO_ENABLED
+        if (now - g_lastSampleTime >= IMU_FIFO_DRAIN_MS) {
+            acquireSamples();
+            g_lastSampleTime = now;
+        }
+        serviceStream();
+#else
+        if (now - g_lastSampleTime >= g_profile->periodMs) {
+            sendSensorData();
+            g_lastSampleTime = now;
+        }
+        serviceStream();
+#endif
+        
+        if (g_linkStatusDirty) {
+            g_linkStatusDirty = false;
+            publishLinkStatus();
+        }
+        
+        // Update battery level periodically
+        if (now - g_lastBatteryTime >= BATTERY_UPDATE_MS) {
+            updateBattery();
+            g_lastBatteryTime = now;
+        }
+    } else {
+        // When not connected: the LED keeps its fast advertising blink
+#if SAMPLE_LOG_ENABLED && !PIPELINE_ENABLED
+        if (g_logging) {
+#if IMU_INTERRUPT_ENABLED
+            if (samplesPending() && drainDue(notified)) {
+                acquireSamples();
+            }
+#else
+            if (now - g_lastSampleTime >= IMU_FIFO_DRAIN_MS) {
+                acquireSamples();
+                g_lastSampleTime = now;
+            }
+#endif
+            logSensorData();
+        }
+#endif
+#if IMU_INTERRUPT_ENABLED && !PIPELINE_ENABLED
+        if (!sampleConsumerActive()) {
+            g_stampRing.clear();  // Nothing consumes samples while advertising
+        }
+#endif
+    }
+    
+#if SLEEP_ENABLED && !USB_TRANSPORT_ENABLED
+    checkIdleSleep();           // USB: bus powered, and a still glove is still captured
+#endif
+}
@@ -0,0 +1,25 @@
+/**
+ * FighterLink Glove Firmware
+ *
+ * The whole application: BLE peripheral, acquisition pipeline, calibration,
+ * logging and sleep, built for the board in board_traits.h. Tunables live
+ * in config.h. The PlatformIO build (src/main.cpp) and the Arduino IDE
+ * sketch (arduino/FighterLink_ESP32) both just forward setup() and loop()
+ * here, with the hand to advertise as.
+ */
+
+#ifndef FIGHTERLINK_H
+#define FIGHTERLINK_H
+
+#include <stdint.h>
+
+#define HAND_LEFT   0   // Advertises as BLE_DEVICE_NAME_LEFT
+#define HAND_RIGHT  1   // Advertises as BLE_DEVICE_NAME_RIGHT
+
+// From setup(): bring up LED, sensor, BLE and the pipeline tasks
+void fighterLinkSetup(uint8_t handId);
+
+// From loop(): connection handling and housekeeping
+void fighterLinkLoop();
+
+#endif // FIGHTERLINK_H
@@ -0,0 +1,102 @@
+/**
+ * FighterLink IMU Calibration Store
+ */
+
+#include <math.h>
+#include <Preferences.h>
+
+#include "config.h"
+#include "imu_calibration.h"
+
+#define CAL_NVS_KEY             "imu"
+#define CAL_GRAVITY_TOLERANCE   0.2f    // Stored |gravity| must be within 20% of 1g
+
+// ─── NVS Store ───────────────────────────────────────────────────────────────
+static bool calibrationValid(const ImuCalibration& cal) {
+    if (cal.version != IMU_CALIBRATION_VERSION) return false;
+
+    const float* values = cal.accOffset;    // accOffset..gravity are contiguous
+    for (int i = 0; i < 9; i++) {
+        if (!isfinite(values[i])) return false;
+    }
+    float g = sqrtf(cal.gravity[0] * cal.gravity[0] + cal.gravity[1] * cal.gravity[1] +
+                    cal.gravity[2] * cal.gravity[2]);
+    return fabsf(g - GRAVITY_MS2) <= CAL_GRAVITY_TOLERANCE * GRAVITY_MS2;
+}
+
+bool calibrationLoad(ImuCalibration& out) {
+    Preferences prefs;
+    if (!prefs.begin(CAL_NVS_NAMESPACE, true)) return false;
+
+    ImuCalibration cal;
+    bool ok = prefs.getBytesLength(CAL_NVS_KEY) == sizeof(ImuCalibration) &&
+              prefs.getBytes(CAL_NVS_KEY, &cal, sizeof(ImuCalibration)) == sizeof(ImuCalibration) &&
+              calibrationValid(cal);
+    prefs.end();
+    if (ok) {
+        out = cal;
+    }
+    return ok;
+}
+
+bool calibrationSave(const ImuCalibration& cal) {
+    Preferences prefs;
+    if (!prefs.begin(CAL_NVS_NAMESPACE, false)) return false;
+
+    bool ok = prefs.putBytes(CAL_NVS_KEY, &cal, sizeof(ImuCalibration)) == sizeof(ImuCalibration);
+    prefs.end();
+    return ok;
+}
+
+// ─── DriftMonitor ────────────────────────────────────────────────────────────
+void DriftMonitor::reset(uint32_t windowSamples, int32_t stillGyro, int32_t stillAccel,
+                         int32_t driftGyro) {
+    _window = windowSamples;
+    _stillSpan[0] = stillAccel;
+    _stillSpan[1] = stillGyro;
+    _drift = driftGyro;
+    _count = 0;
+}
+
+void DriftMonitor::restart(const int16_t* axes) {
+    for (int axis = 0; axis < 6; axis++) {
+        _min[axis] = axes[axis];
+        _max[axis] = axes[axis];
+        _sum[axis] = axes[axis];
+    }
+    _count = 1;
+}
+
+bool DriftMonitor::update(const ImuRawSample& sample) {
+    if (_window == 0) return false;
+
+    const int16_t axes[6] = {sample.accX, sample.accY, sample.accZ,
+                             sample.gyroX, sample.gyroY, sample.gyroZ};
+    if (_count == 0) {
+        restart(axes);
+        return false;
+    }
+
+    // Any movement starts the window over at this sample
+    for (int axis = 0; axis < 6; axis++) {
+        if (axes[axis] < _min[axis]) _min[axis] = axes[axis];
+        if (axes[axis] > _max[axis]) _max[axis] = axes[axis];
+        if (_max[axis] - _min[axis] > _stillSpan[axis / 3]) {
+            restart(axes);
+            return false;
+        }
+        _sum[axis] += axes[axis];
+    }
+    if (++_count < _window) return false;
+
+    bool drifted = false;
+    for (int axis = 0; axis < 3; axis++) {
+        _accelMean[axis] = (float)_sum[axis] / _count;
+        _gyroMean[axis] = (float)_sum[axis + 3] / _count;
+        if (fabsf(_gyroMean[axis]) > _drift) {
+            drifted = true;
+        }
+    }
+    _count = 0;
+    return drifted;
+}
@@ -0,0 +1,71 @@
+/**
+ * FighterLink IMU Calibration Store
+ *
+ * Accel/gyro offsets and the gravity reference persist in NVS, so a glove
+ * that has been calibrated once is ready as soon as the MPU6050 answers:
+ * no stillness wait and no calcOffsets() on later boots.
+ *
+ * Gyro bias still drifts with temperature and age. DriftMonitor watches the
+ * offset-corrected stream for windows where the glove lies still and reports
+ * the residual bias when it exceeds a threshold, so the offsets can be
+ * corrected in the background. The accel offsets assume the first-boot
+ * calibration pose (Z up) and are only set by a full calibration.
+ */
+
+#ifndef IMU_CALIBRATION_H
+#define IMU_CALIBRATION_H
+
+#include <stdint.h>
+
+#include "imu_sample.h"
+
+#define IMU_CALIBRATION_VERSION 1   // Bump when the stored layout changes
+
+// Stored as one NVS blob; offsets use MPU6050_light's units so they survive
+// a range change
+struct ImuCalibration {
+    uint8_t version;        // IMU_CALIBRATION_VERSION
+    uint8_t reserved[3];
+    float accOffset[3];     // g
+    float gyroOffset[3];    // °/s
+    float gravity[3];       // m/s², offset-corrected sensor frame
+};
+
+// Read the stored calibration. Returns false if there is none or it fails
+// the sanity checks (a fresh calibration is needed then).
+bool calibrationLoad(ImuCalibration& out);
+
+// Write the calibration to NVS. Blocks for a flash write: not for the
+// acquisition path.
+bool calibrationSave(const ImuCalibration& cal);
+
+class DriftMonitor {
+public:
+    // Window length in samples; thresholds in offset-corrected LSB for the
+    // active ranges. A window is still while every axis stays within its
+    // span; it ends in drift when a mean gyro axis exceeds driftGyro.
+    void reset(uint32_t windowSamples, int32_t stillGyro, int32_t stillAccel, int32_t driftGyro);
+
+    // Feed one offset-corrected sample. Returns true when a still window
+    // just closed with drift; its means are then in gyroMean()/accelMean().
+    bool update(const ImuRawSample& sample);
+
+    const float* gyroMean() const { return _gyroMean; }
+    const float* accelMean() const { return _accelMean; }
+
+private:
+    void restart(const int16_t* axes);
+
+    uint32_t _window = 0;
+    int32_t _stillSpan[2] = {0, 0};     // Accel, gyro
+    int32_t _drift = 0;
+
+    uint32_t _count = 0;
+    int16_t _min[6];
+    int16_t _max[6];
+    int32_t _sum[6];
+    float _accelMean[3] = {0, 0, 0};
+    float _gyroMean[3] = {0, 0, 0};
+};
+
+#endif // IMU_CALIBRATION_H
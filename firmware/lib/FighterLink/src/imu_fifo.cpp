@@ -0,0 +1,261 @@
+/**
+ * FighterLink MPU6050 FIFO Capture
+ *
+ * Register-level FIFO driver. MPU6050_light keeps handling init and offset
+ * calibration; this unit only touches the rate, DLPF, interrupt, FIFO and
+ * motion-wake power registers, and reads the raw output registers directly.
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include "imu_fifo.h"
+
+// ─── MPU6050 Registers ───────────────────────────────────────────────────────
+#define MPU_REG_SMPLRT_DIV      0x19
+#define MPU_REG_CONFIG          0x1A
+#define MPU_REG_ACCEL_CONFIG    0x1C
+#define MPU_REG_MOT_THR         0x1F
+#define MPU_REG_MOT_DUR         0x20
+#define MPU_REG_FIFO_EN         0x23
+#define MPU_REG_INT_PIN_CFG     0x37
+#define MPU_REG_INT_ENABLE      0x38
+#define MPU_REG_INT_STATUS      0x3A
+#define MPU_REG_ACCEL_XOUT_H    0x3B    // ACCEL XYZ, TEMP, GYRO XYZ (14 bytes)
+#define MPU_REG_USER_CTRL       0x6A
+#define MPU_REG_PWR_MGMT_1      0x6B
+#define MPU_REG_PWR_MGMT_2      0x6C
+#define MPU_REG_FIFO_COUNTH     0x72
+#define MPU_REG_FIFO_R_W        0x74
+
+#define MPU_FIFO_EN_ACCEL_GYRO  0x78    // XG | YG | ZG | ACCEL
+#define MPU_USER_CTRL_FIFO_EN   0x40
+#define MPU_USER_CTRL_FIFO_RST  0x04
+#define MPU_INT_PIN_CFG_PULSE   0x00    // Active high, push-pull, 50us pulse
+#define MPU_INT_DATA_RDY_EN     0x01
+#define MPU_INT_PIN_CFG_LATCH   0x20    // Active high, push-pull, held until INT_STATUS is read
+#define MPU_INT_MOT_EN          0x40
+#define MPU_INT_MOT_STATUS      0x40    // INT_STATUS: MOT_INT
+#define MPU_ACCEL_HPF_MASK      0x07
+#define MPU_ACCEL_HPF_5HZ       0x01
+#define MPU_MOT_THR_MG_PER_LSB  2
+#define MPU_PWR1_CYCLE          0x28    // CYCLE | TEMP_DIS, internal oscillator
+#define MPU_PWR2_STBY_GYRO      0x07    // STBY_XG | STBY_YG | STBY_ZG
+#define MPU_HPF_SETTLE_MS       10
+
+#define MPU_FIFO_SIZE           1024
+#define MPU_RAW_BURST_SIZE      14
+
+// Largest record-aligned read that fits in the Wire receive buffer
+#ifdef I2C_BUFFER_LENGTH
+    #define FIFO_BURST_RECORDS  (I2C_BUFFER_LENGTH / IMU_FIFO_RECORD_SIZE)
+#else
+    #define FIFO_BURST_RECORDS  (32 / IMU_FIFO_RECORD_SIZE)
+#endif
+
+// Once the count reaches the last whole record the FIFO has wrapped
+#define FIFO_FULL_BYTES         ((MPU_FIFO_SIZE / IMU_FIFO_RECORD_SIZE) * IMU_FIFO_RECORD_SIZE)
+
+// ─── State ───────────────────────────────────────────────────────────────────
+static TwoWire* s_wire = nullptr;
+static uint8_t s_address = 0x68;
+static ImuFifoStats s_stats = {};
+
+// ─── Register Access ─────────────────────────────────────────────────────────
+static bool writeReg(uint8_t reg, uint8_t value) {
+    s_wire->beginTransmission(s_address);
+    s_wire->write(reg);
+    s_wire->write(value);
+    return s_wire->endTransmission() == 0;
+}
+
+static uint8_t readBurst(uint8_t reg, uint8_t* buf, uint8_t len) {
+    s_wire->beginTransmission(s_address);
+    s_wire->write(reg);
+    if (s_wire->endTransmission(false) != 0) {
+        return 0;
+    }
+    uint8_t got = s_wire->requestFrom(s_address, len);
+    for (uint8_t i = 0; i < got; i++) {
+        buf[i] = s_wire->read();
+    }
+    return got;
+}
+
+static inline int16_t be16(const uint8_t* p) {
+    return (int16_t)((p[0] << 8) | p[1]);
+}
+
+// ─── Public API ──────────────────────────────────────────────────────────────
+void imuAttach(TwoWire& wire, uint8_t address) {
+    s_wire = &wire;
+    s_address = address;
+}
+
+bool imuReadRaw(ImuRawSample& out) {
+    if (!s_wire) return false;
+
+    uint8_t buf[MPU_RAW_BURST_SIZE];
+    if (readBurst(MPU_REG_ACCEL_XOUT_H, buf, MPU_RAW_BURST_SIZE) != MPU_RAW_BURST_SIZE) {
+        return false;
+    }
+    out.accX  = be16(buf + 0);
+    out.accY  = be16(buf + 2);
+    out.accZ  = be16(buf + 4);
+    // buf[6..7] is TEMP_OUT
+    out.gyroX = be16(buf + 8);
+    out.gyroY = be16(buf + 10);
+    out.gyroZ = be16(buf + 12);
+    return true;
+}
+
+bool imuSetRate(uint8_t sampleRateDiv, uint8_t dlpfCfg) {
+    if (!s_wire) return false;
+    bool ok = writeReg(MPU_REG_CONFIG, dlpfCfg & 0x07);
+    ok &= writeReg(MPU_REG_SMPLRT_DIV, sampleRateDiv);
+    return ok;
+}
+
+bool imuFifoBegin() {
+    if (!s_wire) return false;
+    s_stats = {};
+
+    bool ok = writeReg(MPU_REG_FIFO_EN, MPU_FIFO_EN_ACCEL_GYRO);
+    imuFifoReset();
+    return ok;
+}
+
+bool imuEnableDataReadyInterrupt() {
+    if (!s_wire) return false;
+    bool ok = writeReg(MPU_REG_INT_PIN_CFG, MPU_INT_PIN_CFG_PULSE);
+    ok &= writeReg(MPU_REG_INT_ENABLE, MPU_INT_DATA_RDY_EN);
+    return ok;
+}
+
+// High-pass filter (keeping the full-scale bits), threshold and duration of
+// the motion detector
+static bool writeMotionConfig(uint16_t thresholdMg, uint8_t duration) {
+    uint8_t accelConfig;
+    if (readBurst(MPU_REG_ACCEL_CONFIG, &accelConfig, 1) != 1) {
+        return false;
+    }
+    uint16_t threshold = thresholdMg / MPU_MOT_THR_MG_PER_LSB;
+    bool ok = writeReg(MPU_REG_ACCEL_CONFIG, (accelConfig & ~MPU_ACCEL_HPF_MASK) | MPU_ACCEL_HPF_5HZ);
+    ok &= writeReg(MPU_REG_MOT_THR, threshold > 255 ? 255 : (uint8_t)threshold);
+    ok &= writeReg(MPU_REG_MOT_DUR, duration);
+    return ok;
+}
+
+bool imuEnableMotionWake(uint16_t thresholdMg, uint8_t duration, uint8_t lpWakeCtrl) {
+    if (!s_wire) return false;
+
+    bool ok = writeReg(MPU_REG_INT_ENABLE, 0);
+    ok &= writeReg(MPU_REG_USER_CTRL, 0);
+    ok &= writeReg(MPU_REG_FIFO_EN, 0);
+    ok &= writeMotionConfig(thresholdMg, duration);
+    ok &= writeReg(MPU_REG_INT_PIN_CFG, MPU_INT_PIN_CFG_LATCH);
+    delay(MPU_HPF_SETTLE_MS);  // Let the filter settle before it can trigger
+
+    uint8_t status;
+    readBurst(MPU_REG_INT_STATUS, &status, 1);  // Clear anything latched so far
+    ok &= writeReg(MPU_REG_INT_ENABLE, MPU_INT_MOT_EN);
+    ok &= writeReg(MPU_REG_PWR_MGMT_2, (uint8_t)((lpWakeCtrl & 0x03) << 6) | MPU_PWR2_STBY_GYRO);
+    ok &= writeReg(MPU_REG_PWR_MGMT_1, MPU_PWR1_CYCLE);
+    return ok;
+}
+
+bool imuDisableMotionWake() {
+    if (!s_wire) return false;
+
+    uint8_t status;
+    bool ok = writeReg(MPU_REG_INT_ENABLE, 0);
+    ok &= writeReg(MPU_REG_PWR_MGMT_2, 0);
+    ok &= writeReg(MPU_REG_INT_PIN_CFG, MPU_INT_PIN_CFG_PULSE);
+    readBurst(MPU_REG_INT_STATUS, &status, 1);
+    return ok;
+}
+
+bool imuConfigureMotion(uint16_t thresholdMg, uint8_t duration) {
+    if (!s_wire) return false;
+    return writeMotionConfig(thresholdMg, duration);
+}
+
+bool imuSelectMotionInterrupt(bool motion) {
+    if (!s_wire) return false;
+
+    // Start from a clear status, so only motion from here on counts
+    uint8_t status;
+    readBurst(MPU_REG_INT_STATUS, &status, 1);
+    return writeReg(MPU_REG_INT_ENABLE, motion ? MPU_INT_MOT_EN : MPU_INT_DATA_RDY_EN);
+}
+
+bool imuMotionDetected() {
+    if (!s_wire) return false;
+
+    uint8_t status;
+    if (readBurst(MPU_REG_INT_STATUS, &status, 1) != 1) {
+        return false;
+    }
+    return status & MPU_INT_MOT_STATUS;
+}
+
+void imuFifoReset() {
+    if (!s_wire) return;
+    writeReg(MPU_REG_USER_CTRL, MPU_USER_CTRL_FIFO_RST);
+    writeReg(MPU_REG_USER_CTRL, MPU_USER_CTRL_FIFO_EN);
+}
+
+uint16_t imuFifoRead(ImuRawSample* out, uint16_t maxSamples) {
+    if (!s_wire || maxSamples == 0) return 0;
+
+    uint8_t countBuf[2];
+    if (readBurst(MPU_REG_FIFO_COUNTH, countBuf, 2) != 2) {
+        return 0;
+    }
+    uint16_t count = ((uint16_t)countBuf[0] << 8) | countBuf[1];
+
+    // A full or misaligned FIFO means records were dropped mid-stream;
+    // restart so the next read starts on a record boundary.
+    if (count >= FIFO_FULL_BYTES || count % IMU_FIFO_RECORD_SIZE != 0) {
+        imuFifoReset();
+        s_stats.overflows++;
+        return 0;
+    }
+
+    uint16_t available = count / IMU_FIFO_RECORD_SIZE;
+    uint16_t total = available < maxSamples ? available : maxSamples;
+    uint16_t done = 0;
+
+    uint8_t buf[FIFO_BURST_RECORDS * IMU_FIFO_RECORD_SIZE];
+    while (done < total) {
+        uint16_t chunk = total - done;
+        if (chunk > FIFO_BURST_RECORDS) chunk = FIFO_BURST_RECORDS;
+
+        uint8_t len = chunk * IMU_FIFO_RECORD_SIZE;
+        if (readBurst(MPU_REG_FIFO_R_W, buf, len) != len) {
+            imuFifoReset();
+            s_stats.overflows++;
+            break;
+        }
+        s_stats.bursts++;
+
+        for (uint16_t i = 0; i < chunk; i++) {
+            const uint8_t* p = &buf[i * IMU_FIFO_RECORD_SIZE];
+            ImuRawSample& s = out[done + i];
+            s.accX  = be16(p + 0);
+            s.accY  = be16(p + 2);
+            s.accZ  = be16(p + 4);
+            s.gyroX = be16(p + 6);
+            s.gyroY = be16(p + 8);
+            s.gyroZ = be16(p + 10);
+        }
+        done += chunk;
+    }
+
+    s_stats.samplesRead += done;
+    return done;
+}
+
+const ImuFifoStats& imuFifoStats() {
+    return s_stats;
+}
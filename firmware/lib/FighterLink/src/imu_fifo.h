@@ -0,0 +1,98 @@
+/**
+ * FighterLink MPU6050 FIFO Capture
+ *
+ * The MPU6050 samples accel + gyro at its own output data rate into its
+ * 1 KB on-chip FIFO; the firmware drains it in I2C bursts. Sample cadence is
+ * set by the sensor clock, so loop() stalls (BLE stack, Serial, LED) no
+ * longer drop or double-space samples.
+ *
+ * The same register-level driver provides a single 14-byte burst read of the
+ * live output registers for the non-FIFO path, bypassing MPU6050_light's
+ * float conversion.
+ */
+
+#ifndef IMU_FIFO_H
+#define IMU_FIFO_H
+
+#include <stdint.h>
+#include <Wire.h>
+
+#include "imu_sample.h"
+
+// FIFO health counters
+struct ImuFifoStats {
+    uint32_t samplesRead;   // Records drained since boot
+    uint32_t bursts;        // I2C burst reads of FIFO data
+    uint32_t overflows;     // FIFO overflow/misalignment resets (samples lost)
+};
+
+// Size of one accel + gyro FIFO record in bytes
+#define IMU_FIFO_RECORD_SIZE    12
+
+// Bind the driver to the bus the MPU6050 sits on. Call after mpu.begin().
+void imuAttach(TwoWire& wire, uint8_t address);
+
+/**
+ * Read ACCEL_XOUT..GYRO_ZOUT in one 14-byte burst (temperature skipped).
+ * Returns false on an I2C error.
+ */
+bool imuReadRaw(ImuRawSample& out);
+
+/**
+ * Configure the sample-rate divider and DLPF.
+ *
+ * Output data rate = gyro rate / (1 + sampleRateDiv), where gyro rate is
+ * 1 kHz when the DLPF is enabled (dlpfCfg 1-6) and 8 kHz otherwise.
+ */
+bool imuSetRate(uint8_t sampleRateDiv, uint8_t dlpfCfg);
+
+// Enable accel + gyro writes into the FIFO and start from empty
+bool imuFifoBegin();
+
+/**
+ * Drive the INT pin with a 50 µs active-high pulse each time a new sample
+ * lands in the sensor registers/FIFO (DATA_RDY_EN).
+ */
+bool imuEnableDataReadyInterrupt();
+
+/**
+ * Arm the motion-detect interrupt as a wake source and drop the sensor into
+ * accelerometer-only low-power cycling (gyros in standby, FIFO off). INT then
+ * latches high once high-pass filtered acceleration exceeds thresholdMg for
+ * duration samples. lpWakeCtrl picks the cycle rate (0 = 1.25Hz, 1 = 5Hz,
+ * 2 = 20Hz, 3 = 40Hz).
+ */
+bool imuEnableMotionWake(uint16_t thresholdMg, uint8_t duration, uint8_t lpWakeCtrl);
+
+// Undo imuEnableMotionWake() after a wake (mpu.begin() already leaves the
+// cycle mode but not the gyro standby or the motion interrupt)
+bool imuDisableMotionWake();
+
+/**
+ * Motion detection while streaming: high-pass filtered acceleration above
+ * thresholdMg for duration samples sets the motion status, with the sensor
+ * fully awake and the output registers/FIFO unfiltered. The filter shares
+ * ACCEL_CONFIG with the full-scale range, so call again after changing it.
+ */
+bool imuConfigureMotion(uint16_t thresholdMg, uint8_t duration);
+
+// Drive INT from the motion status (true) instead of data-ready, or back.
+// Either way it pulses as for imuEnableDataReadyInterrupt().
+bool imuSelectMotionInterrupt(bool motion);
+
+// Motion status latched since the last call (reading clears it)
+bool imuMotionDetected();
+
+// Discard FIFO contents and restart capture (e.g. when streaming resumes)
+void imuFifoReset();
+
+/**
+ * Drain up to maxSamples records from the FIFO, oldest first.
+ * Returns the number of records written to out. On overflow the FIFO is
+ * reset and 0 is returned.
+ */
+uint16_t imuFifoRead(ImuRawSample* out, uint16_t maxSamples);
+
+const ImuFifoStats& imuFifoStats();
+
+#endif // IMU_FIFO_H
@@ -0,0 +1,24 @@
+/**
+ * FighterLink Raw IMU Sample
+ *
+ * One accel + gyro reading in raw MPU6050 LSB, as it comes off the FIFO or
+ * the output registers. Kept apart from the bus driver (imu_fifo.h) so the
+ * conversion and calibration code builds without it.
+ */
+
+#ifndef IMU_SAMPLE_H
+#define IMU_SAMPLE_H
+
+#include <stdint.h>
+
+// One FIFO record: accel XYZ + gyro XYZ, raw sensor LSBs (12 bytes on the wire)
+struct ImuRawSample {
+    int16_t accX;
+    int16_t accY;
+    int16_t accZ;
+    int16_t gyroX;
+    int16_t gyroY;
+    int16_t gyroZ;
+};
+
+#endif // IMU_SAMPLE_H
@@ -0,0 +1,42 @@
+/**
+ * FighterLink Link Status
+ *
+ * Value of the status characteristic: the connection parameters the central
+ * actually granted, as opposed to the ones the glove asked for in config.h.
+ * Updated (and notified) whenever the link changes.
+ *
+ * Field      | Offset | Size | Type   | Units
+ * -----------|--------|------|--------|---------------------
+ * interval   | 0      | 2    | uint16 | 1.25 ms
+ * latency    | 2      | 2    | uint16 | connection events
+ * timeout    | 4      | 2    | uint16 | 10 ms
+ * mtu        | 6      | 2    | uint16 | bytes (ATT MTU)
+ * txOctets   | 8      | 2    | uint16 | LL payload, glove → central
+ * rxOctets   | 10     | 2    | uint16 | LL payload, central → glove
+ * txPhy      | 12     | 1    | uint8  | 1 = 1M, 2 = 2M, 3 = Coded
+ * rxPhy      | 13     | 1    | uint8  | 1 = 1M, 2 = 2M, 3 = Coded
+ */
+
+#ifndef LINK_STATUS_H
+#define LINK_STATUS_H
+
+#include <stdint.h>
+
+#define LINK_PHY_1M             1
+#define LINK_PHY_2M             2
+#define LINK_DEFAULT_OCTETS     27      // LL payload before Data Length Extension
+
+struct __attribute__((packed)) LinkStatus {
+    uint16_t interval;
+    uint16_t latency;
+    uint16_t timeout;
+    uint16_t mtu;
+    uint16_t txOctets;
+    uint16_t rxOctets;
+    uint8_t  txPhy;
+    uint8_t  rxPhy;
+};
+
+static_assert(sizeof(LinkStatus) == 14, "LinkStatus must be exactly 14 bytes");
+
+#endif // LINK_STATUS_H
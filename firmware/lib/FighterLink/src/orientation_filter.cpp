@@ -0,0 +1,148 @@
+/**
+ * FighterLink Orientation Filter
+ */
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "orientation_filter.h"
+#include "rate_profile.h"
+
+#define GYRO_EXTRA_BITS     16      // Precision of _gyroFactor beyond Q30
+
+static inline int32_t mulQ(int32_t a, int32_t b) {
+    return (int32_t)(((int64_t)a * b) >> FUSION_Q_SHIFT);
+}
+
+static inline int16_t sat16(int32_t v) {
+    return (int16_t)(v < INT16_MIN ? INT16_MIN : v > INT16_MAX ? INT16_MAX : v);
+}
+
+// Q30 → Q14, rounded
+static inline int16_t toQuat14(int32_t q) {
+    return sat16((q + (1 << 15)) >> (FUSION_Q_SHIFT - 14));
+}
+
+void OrientationFilter::configure(uint8_t accelRange, uint8_t gyroRange, uint32_t periodUs) {
+    const double halfDt = periodUs * 0.5e-6;
+    const double gyroRadPerLsb = M_PI / 180.0 / GYRO_LSB_PER_DPS[gyroRange];
+    _gyroFactor = (uint32_t)(gyroRadPerLsb * halfDt *
+                             (double)(1ull << (FUSION_Q_SHIFT + GYRO_EXTRA_BITS)) + 0.5);
+    _feedback = (int32_t)(FUSION_KP * halfDt * (1 << FUSION_Q_SHIFT) + 0.5);
+
+    // LSB per g is 2^14 >> range
+    const uint32_t lsbPerG = (uint32_t)ACCEL_LSB_PER_G[accelRange];
+    _accelShift = FUSION_Q_SHIFT;
+    for (uint32_t l = lsbPerG; l > 1; l >>= 1) {
+        _accelShift--;
+    }
+    const double low = (1.0 - FUSION_ACCEL_GATE) * lsbPerG;
+    const double high = (1.0 + FUSION_ACCEL_GATE) * lsbPerG;
+    _gateLow = (int64_t)(low * low);
+    _gateHigh = (int64_t)(high * high);
+}
+
+static inline float magnitude(const float v[3]) {
+    return sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+}
+
+void OrientationFilter::setGravity(const float gravity[3]) {
+    float n = magnitude(gravity);
+    _gravity = n < 1.0f ? (int32_t)(GRAVITY_MS2 * ACCEL_SCALE) : lroundf(n * ACCEL_SCALE);
+}
+
+void OrientationFilter::reset(const float gravity[3]) {
+    setGravity(gravity);
+    float n = magnitude(gravity);
+    if (n < 1.0f) {
+        // No usable reference: level
+        _q[0] = 1 << FUSION_Q_SHIFT;
+        _q[1] = _q[2] = _q[3] = 0;
+        updateGravity();
+        return;
+    }
+
+    // Shortest arc taking the measured up direction u onto world Z:
+    // q = (1 + u·z, u × z), or half a turn about X when u points down
+    const float ux = gravity[0] / n, uy = gravity[1] / n, uz = gravity[2] / n;
+    float q[4] = {1.0f + uz, uy, -ux, 0.0f};
+    if (q[0] < 1e-6f) {
+        q[0] = 0.0f;
+        q[1] = 1.0f;
+        q[2] = 0.0f;
+    }
+    float norm = sqrtf(q[0] * q[0] + q[1] * q[1] + q[2] * q[2]);
+    for (int i = 0; i < 4; i++) {
+        _q[i] = lroundf(q[i] / norm * (1 << FUSION_Q_SHIFT));
+    }
+    updateGravity();
+}
+
+void OrientationFilter::update(const ImuRawSample& lsb) {
+    // Half rotation angle over one sample, rad Q30
+    int32_t hx = (int32_t)(((int64_t)lsb.gyroX * _gyroFactor) >> GYRO_EXTRA_BITS);
+    int32_t hy = (int32_t)(((int64_t)lsb.gyroY * _gyroFactor) >> GYRO_EXTRA_BITS);
+    int32_t hz = (int32_t)(((int64_t)lsb.gyroZ * _gyroFactor) >> GYRO_EXTRA_BITS);
+
+    // Tilt correction from the measured gravity direction while the glove is
+    // close to free of linear acceleration. Within the gate |a| is near 1g,
+    // so scaling by 1g stands in for normalising.
+    const int64_t ax = lsb.accX, ay = lsb.accY, az = lsb.accZ;
+    const int64_t norm2 = ax * ax + ay * ay + az * az;
+    if (norm2 >= _gateLow && norm2 <= _gateHigh) {
+        const int32_t gx = (int32_t)(ax << _accelShift);
+        const int32_t gy = (int32_t)(ay << _accelShift);
+        const int32_t gz = (int32_t)(az << _accelShift);
+        // Error is measured × estimated direction
+        hx += mulQ(mulQ(gy, _v[2]) - mulQ(gz, _v[1]), _feedback);
+        hy += mulQ(mulQ(gz, _v[0]) - mulQ(gx, _v[2]), _feedback);
+        hz += mulQ(mulQ(gx, _v[1]) - mulQ(gy, _v[0]), _feedback);
+    }
+
+    // q += q ⊗ (0, h)
+    const int32_t w = _q[0], x = _q[1], y = _q[2], z = _q[3];
+    _q[0] = w - (mulQ(x, hx) + mulQ(y, hy) + mulQ(z, hz));
+    _q[1] = x + (mulQ(w, hx) + mulQ(y, hz) - mulQ(z, hy));
+    _q[2] = y + (mulQ(w, hy) - mulQ(x, hz) + mulQ(z, hx));
+    _q[3] = z + (mulQ(w, hz) + mulQ(x, hy) - mulQ(y, hx));
+
+    // Renormalise with one Newton step of 1/sqrt(n²) around 1: the step
+    // above only moves |q| by about |h|², so no square root is needed
+    int32_t n2 = mulQ(_q[0], _q[0]) + mulQ(_q[1], _q[1]) + mulQ(_q[2], _q[2]) +
+                 mulQ(_q[3], _q[3]);
+    int32_t f = (int32_t)(((3LL << FUSION_Q_SHIFT) - n2) >> 1);
+    for (int i = 0; i < 4; i++) {
+        _q[i] = mulQ(_q[i], f);
+    }
+    updateGravity();
+}
+
+// World Z in the sensor frame: the third row of the rotation matrix
+void OrientationFilter::updateGravity() {
+    const int64_t w = _q[0], x = _q[1], y = _q[2], z = _q[3];
+    _v[0] = (int32_t)((x * z - w * y) >> (FUSION_Q_SHIFT - 1));
+    _v[1] = (int32_t)((w * x + y * z) >> (FUSION_Q_SHIFT - 1));
+    _v[2] = (int32_t)((w * w - x * x - y * y + z * z) >> FUSION_Q_SHIFT);
+}
+
+FusionRecord OrientationFilter::output(const SampleRecord& record) const {
+    FusionRecord out;
+    out.quatW = toQuat14(_q[0]);
+    out.quatX = toQuat14(_q[1]);
+    out.quatY = toQuat14(_q[2]);
+    out.quatZ = toQuat14(_q[3]);
+    out.linAccX = sat16(record.accX - mulQ(_v[0], _gravity));
+    out.linAccY = sat16(record.accY - mulQ(_v[1], _gravity));
+    out.linAccZ = sat16(record.accZ - mulQ(_v[2], _gravity));
+    return out;
+}
+
+// Same row as updateGravity() on the Q14 quaternion; only the ratios matter
+uint8_t fusionUpAxis(const FusionRecord& fusion) {
+    const int32_t w = fusion.quatW, x = fusion.quatX, y = fusion.quatY, z = fusion.quatZ;
+    const int32_t vx = abs(2 * (x * z - w * y));
+    const int32_t vy = abs(2 * (w * x + y * z));
+    const int32_t vz = abs(w * w - x * x - y * y + z * z);
+    if (vx >= vy && vx >= vz) return 0;
+    return vy >= vz ? 1 : 2;
+}
@@ -0,0 +1,68 @@
+/**
+ * FighterLink Orientation Filter
+ *
+ * Mahony complementary filter in fixed point, run on every captured sample
+ * so the attitude follows the glove through a combination instead of
+ * relying on the one gravity reference taken at calibration. The gyro
+ * integrates the attitude quaternion; the accelerometer pulls its tilt back
+ * towards measured gravity, but only while the reading is within
+ * FUSION_ACCEL_GATE of 1g, so a punch does not tip the estimate over.
+ *
+ * All state is Q30 int32 with 64-bit products; the only per-sample
+ * divisions are shifts (ACCEL_LSB_PER_G is a power of two for every range),
+ * so it costs the ESP32-C3 no float. Gyro bias is left to the drift
+ * correction upstream (imu_calibration.h), so there is no integral term.
+ * Heading has no reference and drifts, which neither the gravity direction
+ * nor the linear acceleration depends on. Hardware-independent.
+ */
+
+#ifndef ORIENTATION_FILTER_H
+#define ORIENTATION_FILTER_H
+
+#include <stdint.h>
+
+#include "config.h"
+#include "imu_sample.h"
+#include "sensor_packet.h"
+
+#define FUSION_Q_SHIFT      30      // Fraction bits of quaternion and unit vectors
+
+class OrientationFilter {
+public:
+    // Ranges and nominal spacing (µs) of the samples that follow. Keeps the
+    // attitude.
+    void configure(uint8_t accelRange, uint8_t gyroRange, uint32_t periodUs);
+
+    // Level the attitude on a gravity vector (m/s², sensor frame) with zero
+    // heading, and take its magnitude as in setGravity()
+    void reset(const float gravity[3]);
+
+    // Magnitude removed from linear acceleration, from a gravity vector
+    // (m/s²). Keeps the attitude.
+    void setGravity(const float gravity[3]);
+
+    // Offset-corrected LSB for the configured ranges
+    void update(const ImuRawSample& lsb);
+
+    // Attitude after the last update, and record (the same sample in packet
+    // units) minus gravity along it
+    FusionRecord output(const SampleRecord& record) const;
+
+private:
+    void updateGravity();
+
+    int32_t _q[4] = {1 << FUSION_Q_SHIFT, 0, 0, 0};    // w, x, y, z
+    int32_t _v[3] = {0, 0, 1 << FUSION_Q_SHIFT};       // Gravity direction, sensor frame
+    uint32_t _gyroFactor = 0;   // LSB → half-angle per sample, Q(30 + 16)
+    int32_t _feedback = 0;      // Kp·dt/2, Q30
+    uint8_t _accelShift = 16;   // LSB → g, Q30
+    int64_t _gateLow = 0;       // Accepted |a|², LSB²
+    int64_t _gateHigh = 0;
+    int32_t _gravity = (int32_t)(GRAVITY_MS2 * ACCEL_SCALE);   // |g|, packet units
+};
+
+// Sensor axis (0 = X, 1 = Y, 2 = Z) closest to up at the attitude of a fused
+// record, as PunchDetector::upAxis() from calibration
+uint8_t fusionUpAxis(const FusionRecord& fusion);
+
+#endif // ORIENTATION_FILTER_H
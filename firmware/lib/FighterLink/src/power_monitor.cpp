@@ -0,0 +1,110 @@
+/**
+ * FighterLink Power Monitor
+ *
+ * Integer-only (the C3 has no FPU). Arduino-ESP32 2.x has no continuous/DMA
+ * ADC API, so a timer-paced task oversamples with analogRead() instead.
+ * Boards without power sense report a full battery that never charges.
+ */
+
+#include <Arduino.h>
+#include <atomic>
+
+#include "board_traits.h"
+#include "config.h"
+#include "power_monitor.h"
+
+// ─── Constants ───────────────────────────────────────────────────────────────
+constexpr int32_t VBAT_MIN_MV = (int32_t)(VBAT_MIN * 1000.0f + 0.5f);
+constexpr int32_t VBAT_MAX_MV = (int32_t)(VBAT_MAX * 1000.0f + 0.5f);
+constexpr int32_t VCHARGE_THRESH_MV = (int32_t)(VCHARGE_THRESH * 1000.0f + 0.5f);
+
+// Fractional bits kept in the filter state
+#define FILTER_FRAC_BITS    4
+
+// ─── State ───────────────────────────────────────────────────────────────────
+// Published snapshot: [31:16] battery mV, [15:8] percent, [0] charging
+static std::atomic<uint32_t> s_cache{0};
+
+// Sampler-task only
+static int32_t s_batteryFiltered = 0;   // mV << FILTER_FRAC_BITS
+static int32_t s_chargeFiltered = 0;
+static bool s_charging = false;
+
+// ─── Measurement ─────────────────────────────────────────────────────────────
+// Average of POWER_OVERSAMPLE reads, in millivolts at the divider input
+// (3.3V reference, ×2 divider - calibrate for your specific circuit)
+static int32_t readMillivolts(uint8_t pin) {
+    int32_t sum = 0;
+    for (int i = 0; i < POWER_OVERSAMPLE; i++) {
+        sum += analogRead(pin);
+    }
+    return sum * 3300 * 2 / (4095 * POWER_OVERSAMPLE);
+}
+
+static void publish() {
+    int32_t batteryMv = s_batteryFiltered >> FILTER_FRAC_BITS;
+    int32_t chargeMv = s_chargeFiltered >> FILTER_FRAC_BITS;
+    
+    // Hysteresis so a voltage sitting on the threshold doesn't flap the flag
+    if (s_charging) {
+        s_charging = chargeMv > VCHARGE_THRESH_MV - VCHARGE_HYST_MV;
+    } else {
+        s_charging = chargeMv > VCHARGE_THRESH_MV;
+    }
+    
+    int32_t percent = (batteryMv - VBAT_MIN_MV) * 100 / (VBAT_MAX_MV - VBAT_MIN_MV);
+    percent = constrain(percent, (int32_t)0, (int32_t)100);
+    
+    uint32_t packed = ((uint32_t)constrain(batteryMv, (int32_t)0, (int32_t)UINT16_MAX) << 16) |
+                      ((uint32_t)percent << 8) |
+                      (s_charging ? 1u : 0u);
+    s_cache.store(packed, std::memory_order_relaxed);
+}
+
+static void sample() {
+    // Single-pole IIR: y += (x - y) / 2^POWER_FILTER_SHIFT
+    s_batteryFiltered += ((readMillivolts(Board::pinVbat) << FILTER_FRAC_BITS) - s_batteryFiltered)
+                         >> POWER_FILTER_SHIFT;
+    s_chargeFiltered += ((readMillivolts(Board::pinVcharge) << FILTER_FRAC_BITS) - s_chargeFiltered)
+                        >> POWER_FILTER_SHIFT;
+    publish();
+}
+
+static void powerTask(void* param) {
+    TickType_t lastWake = xTaskGetTickCount();
+    for (;;) {
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(POWER_SAMPLE_MS));
+        sample();
+    }
+}
+
+// ─── Public API ──────────────────────────────────────────────────────────────
+void powerMonitorBegin() {
+    if constexpr (!Board::hasPowerSense) {
+        s_batteryFiltered = VBAT_MAX_MV << FILTER_FRAC_BITS;
+        publish();
+        return;
+    }
+    
+    pinMode(Board::pinVbat, INPUT);
+    pinMode(Board::pinVcharge, INPUT);
+    
+    // Seed the filters so the first reading is already meaningful
+    s_batteryFiltered = readMillivolts(Board::pinVbat) << FILTER_FRAC_BITS;
+    s_chargeFiltered = readMillivolts(Board::pinVcharge) << FILTER_FRAC_BITS;
+    publish();
+    
+    xTaskCreate(powerTask, "power", POWER_TASK_STACK, nullptr, POWER_TASK_PRIORITY, nullptr);
+}
+
+uint8_t powerBatteryPercent() {
+    return (uint8_t)(s_cache.load(std::memory_order_relaxed) >> 8);
+}
+
+uint16_t powerBatteryMillivolts() {
+    return (uint16_t)(s_cache.load(std::memory_order_relaxed) >> 16);
+}
+
+bool powerIsCharging() {
+    return s_cache.load(std::memory_order_relaxed) & 1u;
+}
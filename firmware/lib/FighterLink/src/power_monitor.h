@@ -0,0 +1,23 @@
+/**
+ * FighterLink Power Monitor
+ *
+ * Samples battery and charge-detect voltages from a low-priority background
+ * task (oversampled, then IIR-filtered) and publishes the result into a
+ * lock-free cache. The sample/packet path only reads the cache, so no
+ * analogRead() ever runs at the sensor rate.
+ */
+
+#ifndef POWER_MONITOR_H
+#define POWER_MONITOR_H
+
+#include <stdint.h>
+
+// Take a first synchronous measurement, then start the sampler task
+void powerMonitorBegin();
+
+// Latest filtered values (any task)
+uint8_t powerBatteryPercent();
+uint16_t powerBatteryMillivolts();
+bool powerIsCharging();
+
+#endif // POWER_MONITOR_H
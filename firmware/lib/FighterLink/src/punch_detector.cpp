@@ -0,0 +1,103 @@
+/**
+ * FighterLink On-Glove Punch Detector
+ *
+ * Thresholds mirror server/analytics/analyzer.go so both sides agree on
+ * what counts as a punch.
+ */
+
+#include <math.h>
+
+#include "config.h"
+#include "punch_detector.h"
+
+PunchDetector::PunchDetector() {
+    // Default: Z-down, same fallback as captureGravityReference()
+    _gravity[0] = 0.0f;
+    _gravity[1] = 0.0f;
+    _gravity[2] = GRAVITY_MS2;
+}
+
+void PunchDetector::setGravity(float gx, float gy, float gz) {
+    _gravity[0] = gx;
+    _gravity[1] = gy;
+    _gravity[2] = gz;
+    _hasGravity = true;
+
+    // The axis carrying most of gravity points "up" (detectOrientation)
+    float absX = fabsf(gx), absY = fabsf(gy), absZ = fabsf(gz);
+    if (absZ >= absX && absZ >= absY) {
+        _upAxis = 2;
+    } else if (absY >= absX) {
+        _upAxis = 1;
+    } else {
+        _upAxis = 0;
+    }
+}
+
+bool PunchDetector::update(float ax, float ay, float az,
+                           float gx, float gy, float gz, uint32_t timestamp) {
+    // Gravity-compensated acceleration magnitude
+    float px = ax - _gravity[0];
+    float py = ay - _gravity[1];
+    float pz = az - _gravity[2];
+    float mag = sqrtf(px * px + py * py + pz * pz);
+    float rotation = fabsf(gz);
+    _triggered = false;
+
+    if (_open) {
+        if (mag > _pending.peakForce) _pending.peakForce = mag;
+        if (rotation > _pending.peakRotation) _pending.peakRotation = rotation;
+
+        if (timestamp - _pending.timestamp >= PUNCH_PEAK_WINDOW_MS * 1000UL) {
+            _open = false;
+            _event = _pending;
+            return true;
+        }
+        return false;
+    }
+
+    // Threshold + debounce (measured from the previous crossing)
+    if (mag > PUNCH_THRESHOLD_MS2 && timestamp - _lastPunchTs > PUNCH_DEBOUNCE_MS * 1000UL) {
+        _open = true;
+        _triggered = true;
+        _lastPunchTs = timestamp;
+
+        _pending.type = classifyPunch(gx, gy, gz, _upAxis);
+        _pending.peakForce = mag;
+        _pending.peakRotation = rotation;
+        _pending.timestamp = timestamp;
+        _pending.count = ++_count;
+    }
+    return false;
+}
+
+uint8_t classifyPunch(float gx, float gy, float gz, uint8_t upAxis) {
+    float absGX = fabsf(gx);
+    float absGY = fabsf(gy);
+    float absGZ = fabsf(gz);
+
+    // Hook: high rotation around the vertical (up) axis
+    float upRotation = upAxis == 0 ? absGX : upAxis == 1 ? absGY : absGZ;
+    if (upRotation > PUNCH_HOOK_GYRO_THRESH) {
+        return PUNCH_TYPE_HOOK;
+    }
+
+    // Uppercut: high rotation around the horizontal axes
+    float horizontalRotation;
+    switch (upAxis) {
+        case 0:  horizontalRotation = fmaxf(absGY, absGZ); break;
+        case 1:  horizontalRotation = fmaxf(absGX, absGZ); break;
+        default: horizontalRotation = fmaxf(absGX, absGY); break;
+    }
+    if (horizontalRotation > PUNCH_UPPERCUT_GYRO_THRESH) {
+        return PUNCH_TYPE_UPPERCUT;
+    }
+
+    // Straight: low rotation overall
+    float maxRotation = fmaxf(absGX, fmaxf(absGY, absGZ));
+    if (maxRotation < PUNCH_STRAIGHT_GYRO_MAX) {
+        return PUNCH_TYPE_STRAIGHT;
+    }
+
+    return PUNCH_TYPE_UNKNOWN;
+}
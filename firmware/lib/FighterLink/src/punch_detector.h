@@ -0,0 +1,68 @@
+/**
+ * FighterLink On-Glove Punch Detector
+ *
+ * Port of the server's Analyzer.ProcessPacket punch logic: gravity
+ * compensation against the calibration reference, punchThreshold +
+ * debounceMS gating, and gyro-axis classification relative to the
+ * calibrated "up" axis. Hardware-independent.
+ *
+ * A punch opens at the threshold crossing (classified from that sample,
+ * as the server does) and stays open for PUNCH_PEAK_WINDOW_MS to track
+ * peak force and rotation before it is reported.
+ */
+
+#ifndef PUNCH_DETECTOR_H
+#define PUNCH_DETECTOR_H
+
+#include <stdint.h>
+
+#include "sensor_packet.h"
+
+struct PunchEvent {
+    uint8_t  type;          // PUNCH_TYPE_*
+    float    peakForce;     // m/s², gravity-compensated magnitude
+    float    peakRotation;  // °/s, peak |gyroZ| (server's RotationZ)
+    uint32_t timestamp;     // µs, threshold crossing
+    uint16_t count;         // Punch number since boot
+};
+
+class PunchDetector {
+public:
+    PunchDetector();
+
+    // Gravity vector in sensor frame (m/s²) captured while still
+    void setGravity(float gx, float gy, float gz);
+    bool hasGravity() const { return _hasGravity; }
+    uint8_t upAxis() const { return _upAxis; }
+    const float* gravity() const { return _gravity; }
+
+    // Feed one sample (m/s², °/s, µs timestamp). Returns true when a punch
+    // window closes; the finished punch is then available from event().
+    bool update(float ax, float ay, float az,
+                float gx, float gy, float gz, uint32_t timestamp);
+
+    const PunchEvent& event() const { return _event; }
+
+    // The last update() crossed the threshold and opened a punch
+    bool triggered() const { return _triggered; }
+
+    // Punches detected since boot
+    uint16_t count() const { return _count; }
+
+private:
+    float _gravity[3];
+    bool _hasGravity = false;
+    uint8_t _upAxis = 2;
+
+    bool _open = false;
+    bool _triggered = false;
+    uint32_t _lastPunchTs = 0;
+    uint16_t _count = 0;
+    PunchEvent _pending = {};
+    PunchEvent _event = {};
+};
+
+// Classify from rotation rates (°/s) around each sensor axis
+uint8_t classifyPunch(float gx, float gy, float gz, uint8_t upAxis);
+
+#endif // PUNCH_DETECTOR_H
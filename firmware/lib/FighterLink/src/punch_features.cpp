@@ -0,0 +1,121 @@
+/**
+ * FighterLink Punch Features
+ *
+ * The reduction runs once per punch over at most PUNCH_WINDOW_SAMPLES
+ * samples, so it uses float freely; add() stays integer.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "punch_detector.h"
+#include "punch_features.h"
+
+static inline float magnitude(const int16_t v[3]) {
+    return sqrtf((float)v[0] * v[0] + (float)v[1] * v[1] + (float)v[2] * v[2]) / ACCEL_SCALE;
+}
+
+bool PunchWindow::add(const int16_t linAcc[3], const int16_t gyro[3], uint32_t timestamp) {
+    Sample& slot = _samples[_next];
+    slot.timestamp = timestamp;
+    for (int axis = 0; axis < 3; axis++) {
+        slot.linAcc[axis] = linAcc[axis];
+        slot.gyro[axis] = gyro[axis];
+    }
+    _next = (_next + 1) & (PUNCH_WINDOW_SAMPLES - 1);
+    if (_count < PUNCH_WINDOW_SAMPLES) {
+        _count++;
+    }
+
+    if (!_open) return false;
+    _since++;
+
+    // Close on time, or before the buffer starts losing the pre-trigger side
+    bool elapsed = timestamp - _features.timestamp >= PUNCH_POST_TRIGGER_MS * 1000UL;
+    if (!elapsed && _pre + 1 + _since < PUNCH_WINDOW_SAMPLES) return false;
+
+    extract();
+    _open = false;
+    return true;
+}
+
+void PunchWindow::trigger(uint16_t count, uint8_t upAxis) {
+    if (_open || _count == 0) return;
+
+    const uint32_t crossing = at(_count - 1).timestamp;
+    _pre = 0;
+    while (_pre + 1 < _count &&
+           crossing - at(_count - 2 - _pre).timestamp <= PUNCH_PRE_TRIGGER_MS * 1000UL) {
+        _pre++;
+    }
+
+    _open = true;
+    _since = 0;
+    _upAxis = upAxis;
+    _features = {};
+    _features.count = count;
+    _features.timestamp = crossing;
+}
+
+void PunchWindow::extract() {
+    const uint16_t length = _pre + 1 + _since;
+    const uint16_t first = _count - length;
+
+    // Peak force and its direction, and the signed peak of each gyro axis
+    uint16_t peak = first;
+    float peakForce = 0.0f;
+    int16_t peakGyro[3] = {0, 0, 0};
+    for (uint16_t i = first; i < _count; i++) {
+        const Sample& s = at(i);
+        float force = magnitude(s.linAcc);
+        if (force > peakForce) {
+            peakForce = force;
+            peak = i;
+        }
+        for (int axis = 0; axis < 3; axis++) {
+            if (abs(s.gyro[axis]) > abs(peakGyro[axis])) {
+                peakGyro[axis] = s.gyro[axis];
+            }
+        }
+    }
+
+    // Impact: the contiguous run above PUNCH_IMPACT_MS2 around the peak,
+    // integrated sample by sample over the spacing to the next one
+    uint16_t onset = peak;
+    while (onset > first && magnitude(at(onset - 1).linAcc) >= PUNCH_IMPACT_MS2) {
+        onset--;
+    }
+    uint16_t end = peak;
+    while (end + 1 < _count && magnitude(at(end + 1).linAcc) >= PUNCH_IMPACT_MS2) {
+        end++;
+    }
+    float impulse = 0.0f;
+    for (uint16_t i = onset; i < end; i++) {
+        impulse += magnitude(at(i).linAcc) * (at(i + 1).timestamp - at(i).timestamp) * 1e-6f;
+    }
+
+    // Retraction: the strongest acceleration against the peak direction
+    // after the peak, i.e. the arm braking and pulling the glove back
+    const Sample& p = at(peak);
+    uint16_t retraction = peak;
+    int64_t strongest = 0;
+    for (uint16_t i = peak + 1; i < _count; i++) {
+        const Sample& s = at(i);
+        int64_t along = (int64_t)s.linAcc[0] * p.linAcc[0] + (int64_t)s.linAcc[1] * p.linAcc[1] +
+                        (int64_t)s.linAcc[2] * p.linAcc[2];
+        if (along < strongest) {
+            strongest = along;
+            retraction = i;
+        }
+    }
+
+    for (int axis = 0; axis < 3; axis++) {
+        _features.peakGyro[axis] = (float)peakGyro[axis] / GYRO_SCALE;
+    }
+    _features.type = classifyPunch(_features.peakGyro[0], _features.peakGyro[1],
+                                   _features.peakGyro[2], _upAxis);
+    _features.peakForce = peakForce;
+    _features.impulse = impulse;
+    _features.durationUs = at(end).timestamp - at(onset).timestamp;
+    _features.retractionUs = at(retraction).timestamp - p.timestamp;
+}
@@ -0,0 +1,73 @@
+/**
+ * FighterLink Punch Features
+ *
+ * Pre/post-trigger window around each detected punch, reduced to a feature
+ * vector at the full sensor rate instead of the one sample the stream
+ * carries at the crossing: peak and integrated linear acceleration, impact
+ * duration, signed peak angular velocity per axis and retraction time.
+ *
+ * Every sample goes into a PUNCH_WINDOW_SAMPLES circular buffer (integers
+ * only, so the per-sample cost is one copy). When the detector triggers,
+ * the window closes PUNCH_POST_TRIGGER_MS later, or earlier if the buffer
+ * would start overwriting PUNCH_PRE_TRIGGER_MS before the crossing, and is
+ * reduced once. Hardware-independent.
+ */
+
+#ifndef PUNCH_FEATURES_H
+#define PUNCH_FEATURES_H
+
+#include <stdint.h>
+
+#include "config.h"
+
+static_assert((PUNCH_WINDOW_SAMPLES & (PUNCH_WINDOW_SAMPLES - 1)) == 0,
+              "PUNCH_WINDOW_SAMPLES must be a power of two");
+
+struct PunchFeatures {
+    uint8_t  type;          // PUNCH_TYPE_*, from the peak rotation rates
+    uint16_t count;         // Punch number since boot
+    uint32_t timestamp;     // µs, threshold crossing
+    float    peakForce;     // m/s², peak |linear acceleration|
+    float    impulse;       // m/s, |linear acceleration| integrated over the impact
+    float    peakGyro[3];   // °/s, signed peak per axis
+    uint32_t durationUs;    // Impact: contiguous span above PUNCH_IMPACT_MS2 around the peak
+    uint32_t retractionUs;  // Peak → strongest acceleration against the punch direction
+};
+
+class PunchWindow {
+public:
+    // One sample in packet units: gravity-free acceleration, rotation rates
+    // and µs timestamp. Returns true on the sample that completes a
+    // triggered window; features() holds its punch from then.
+    bool add(const int16_t linAcc[3], const int16_t gyro[3], uint32_t timestamp);
+
+    // The newest sample crossed the punch threshold. Ignored while a window
+    // is still open.
+    void trigger(uint16_t count, uint8_t upAxis);
+
+    const PunchFeatures& features() const { return _features; }
+
+private:
+    struct Sample {
+        uint32_t timestamp;
+        int16_t linAcc[3];
+        int16_t gyro[3];
+    };
+
+    // i-th valid sample, oldest first
+    const Sample& at(uint16_t i) const {
+        return _samples[(_next - _count + i) & (PUNCH_WINDOW_SAMPLES - 1)];
+    }
+    void extract();
+
+    Sample _samples[PUNCH_WINDOW_SAMPLES];
+    uint16_t _next = 0;         // Slot of the next sample
+    uint16_t _count = 0;        // Valid samples, up to PUNCH_WINDOW_SAMPLES
+    bool _open = false;
+    uint16_t _pre = 0;          // Samples within PUNCH_PRE_TRIGGER_MS before the trigger
+    uint16_t _since = 0;        // Samples after the trigger sample
+    uint8_t _upAxis = 2;
+    PunchFeatures _features = {};
+};
+
+#endif // PUNCH_FEATURES_H
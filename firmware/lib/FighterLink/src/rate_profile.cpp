@@ -0,0 +1,24 @@
+/**
+ * FighterLink Sample-Rate Profiles
+ *
+ * On-air budget (payload only): raw batches cost 12 bytes/sample, delta
+ * batches typically 4-7. At 1kHz that is ~5-7kB/s delta, or 20-30 full
+ * 244-byte notifications per second.
+ */
+
+#include "rate_profile.h"
+
+static const RateProfile s_profiles[RATE_PROFILE_COUNT] = {
+    // rate  ms   µs     div  dlpf  bw   accel             gyro                batch  encoding        drain
+    {  100,  10,  10000, 9,   3,    44,  ACCEL_RANGE_2G,   GYRO_RANGE_500DPS,  false, ENCODING_RAW,   1 },
+    {  200,  5,   5000,  4,   2,    94,  ACCEL_RANGE_8G,   GYRO_RANGE_1000DPS, true,  ENCODING_RAW,   1 },
+    {  500,  2,   2000,  1,   1,    184, ACCEL_RANGE_16G,  GYRO_RANGE_2000DPS, true,  ENCODING_DELTA, 2 },
+    {  1000, 1,   1000,  0,   1,    184, ACCEL_RANGE_16G,  GYRO_RANGE_2000DPS, true,  ENCODING_DELTA, 4 },
+};
+
+const RateProfile& rateProfile(uint8_t id) {
+    if (id >= RATE_PROFILE_COUNT) {
+        id = RATE_PROFILE_100HZ;
+    }
+    return s_profiles[id];
+}
@@ -0,0 +1,60 @@
+/**
+ * FighterLink Sample-Rate Profiles
+ *
+ * A profile configures the MPU6050 output data rate, DLPF bandwidth and
+ * full-scale ranges together, and states what the BLE transport must do to
+ * carry that rate: above 100Hz single 20-byte notifications cannot keep up,
+ * so those profiles require batching (and delta encoding at 500Hz+).
+ *
+ * Packet units (m/s² × ACCEL_SCALE, °/s × GYRO_SCALE) are the same for every
+ * profile, so receivers need no per-profile scaling: ±16g is 15696 and
+ * ±2000°/s is 20000 at the extremes, both within int16.
+ */
+
+#ifndef RATE_PROFILE_H
+#define RATE_PROFILE_H
+
+#include <stdint.h>
+
+#include "sample_batcher.h"
+
+// Profile IDs
+#define RATE_PROFILE_100HZ      0       // Legacy: library default ranges
+#define RATE_PROFILE_200HZ      1
+#define RATE_PROFILE_500HZ      2
+#define RATE_PROFILE_1000HZ     3
+#define RATE_PROFILE_COUNT      4
+
+// Full-scale range codes (AFS_SEL / FS_SEL, MPU6050_light config numbers)
+#define ACCEL_RANGE_2G          0
+#define ACCEL_RANGE_4G          1
+#define ACCEL_RANGE_8G          2
+#define ACCEL_RANGE_16G         3
+#define GYRO_RANGE_250DPS       0
+#define GYRO_RANGE_500DPS       1
+#define GYRO_RANGE_1000DPS      2
+#define GYRO_RANGE_2000DPS      3
+#define SENSOR_RANGE_COUNT      4
+
+// Datasheet sensitivities per range code
+constexpr float ACCEL_LSB_PER_G[SENSOR_RANGE_COUNT] = {16384.0f, 8192.0f, 4096.0f, 2048.0f};
+constexpr float GYRO_LSB_PER_DPS[SENSOR_RANGE_COUNT] = {131.0f, 65.5f, 32.8f, 16.4f};
+
+struct RateProfile {
+    uint16_t rateHz;
+    uint8_t periodMs;
+    uint16_t periodUs;          // Nominal sample spacing on the µs sample clock
+    uint8_t sampleRateDiv;      // ODR = 1kHz / (1 + div) with the DLPF on
+    uint8_t dlpfCfg;            // CONFIG.DLPF_CFG
+    uint16_t dlpfHz;            // Accel bandwidth of dlpfCfg (for logging)
+    uint8_t accelRange;         // ACCEL_RANGE_*
+    uint8_t gyroRange;          // GYRO_RANGE_*
+    bool batchRequired;         // Legacy packets can't carry this rate
+    BatchEncoding minEncoding;  // Cheapest encoding that fits on air
+    uint8_t drainSamples;       // FIFO records per drain in interrupt mode
+};
+
+// Profile by ID; unknown IDs fall back to RATE_PROFILE_100HZ
+const RateProfile& rateProfile(uint8_t id);
+
+#endif // RATE_PROFILE_H
@@ -0,0 +1,49 @@
+/**
+ * FighterLink Resend Buffer
+ */
+
+#include <string.h>
+
+#include "resend_buffer.h"
+
+// ─── ResendBuffer ────────────────────────────────────────────────────────────
+void ResendBuffer::store(const uint8_t* frame, size_t length, uint32_t sequence, uint16_t count) {
+    if (length == 0 || length > RESEND_MAX_FRAME || count == 0) return;
+
+    // Evict the oldest frames until the new one fits both rings
+    while (_frames > 0 && (_frames == RESEND_MAX_FRAMES ||
+                           _head + length - entry(0).offset > RESEND_BUFFER_BYTES)) {
+        _first = (_first + 1) & (RESEND_MAX_FRAMES - 1);
+        _frames--;
+    }
+
+    size_t at = _head & (RESEND_BUFFER_BYTES - 1);
+    size_t split = length < RESEND_BUFFER_BYTES - at ? length : RESEND_BUFFER_BYTES - at;
+    memcpy(_data + at, frame, split);
+    memcpy(_data, frame + split, length - split);
+
+    Entry& e = _index[(_first + _frames) & (RESEND_MAX_FRAMES - 1)];
+    e.offset = _head;
+    e.sequence = sequence;
+    e.count = count;
+    e.length = (uint16_t)length;
+    _frames++;
+    _head += length;
+}
+
+size_t ResendBuffer::find(uint32_t sequence, uint32_t end, uint8_t* out, uint32_t& next) const {
+    for (uint32_t i = 0; i < _frames; i++) {
+        const Entry& e = entry(i);
+        uint32_t frameEnd = e.sequence + e.count;
+        if ((int32_t)(frameEnd - sequence) <= 0) continue;     // Before the range
+        if ((int32_t)(end - e.sequence) <= 0) break;           // Past it (frames are in order)
+
+        size_t at = e.offset & (RESEND_BUFFER_BYTES - 1);
+        size_t split = e.length < RESEND_BUFFER_BYTES - at ? e.length : RESEND_BUFFER_BYTES - at;
+        memcpy(out, _data + at, split);
+        memcpy(out + split, _data, e.length - split);
+        next = frameEnd;
+        return e.length;
+    }
+    return 0;
+}
@@ -0,0 +1,65 @@
+/**
+ * FighterLink Resend Buffer
+ *
+ * Keeps the most recent sample frames exactly as they were notified, indexed
+ * by the sequence range they carry, so the central can ask for samples it
+ * missed (CONTROL_OP_RESEND, see stream_control.h). Resent frames go out on
+ * the bulk characteristic unchanged: same sequence numbers and timestamps,
+ * so the central slots them into the gaps it saw.
+ *
+ * Frames are copied into a byte ring and the oldest are evicted as new ones
+ * arrive, so how far back a resend reaches depends on rate and encoding
+ * (RESEND_BUFFER_BYTES / RESEND_MAX_FRAMES in config.h). Sequences are
+ * compared modulo 2^32. Hardware-independent; single task only (the
+ * transmission side both stores and resends).
+ */
+
+#ifndef RESEND_BUFFER_H
+#define RESEND_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "sample_batcher.h"
+
+#define RESEND_MAX_FRAME    BATCH_MAX_PAYLOAD
+
+static_assert((RESEND_MAX_FRAMES & (RESEND_MAX_FRAMES - 1)) == 0,
+              "RESEND_MAX_FRAMES must be a power of two");
+static_assert((RESEND_BUFFER_BYTES & (RESEND_BUFFER_BYTES - 1)) == 0 &&
+              RESEND_BUFFER_BYTES >= RESEND_MAX_FRAME,
+              "RESEND_BUFFER_BYTES must be a power of two and hold a frame");
+
+class ResendBuffer {
+public:
+    // Keep a copy of a frame holding samples [sequence, sequence + count)
+    void store(const uint8_t* frame, size_t length, uint32_t sequence, uint16_t count);
+
+    // Copy the oldest kept frame holding any sample in [sequence, end) into
+    // out (RESEND_MAX_FRAME bytes) and set next to the sequence after it.
+    // Returns the frame length, 0 if none is left.
+    size_t find(uint32_t sequence, uint32_t end, uint8_t* out, uint32_t& next) const;
+
+    bool empty() const { return _frames == 0; }
+
+    void clear() { _first = 0; _frames = 0; }
+
+private:
+    struct Entry {
+        uint32_t offset;    // Position in the byte stream (mod 2^32)
+        uint32_t sequence;  // Sequence of the frame's first sample
+        uint16_t count;     // Samples in the frame
+        uint16_t length;    // Frame bytes
+    };
+
+    const Entry& entry(uint32_t i) const { return _index[(_first + i) & (RESEND_MAX_FRAMES - 1)]; }
+
+    uint8_t _data[RESEND_BUFFER_BYTES];
+    Entry _index[RESEND_MAX_FRAMES];
+    uint32_t _head = 0;     // Bytes ever stored
+    uint32_t _first = 0;    // Index slot of the oldest frame
+    uint32_t _frames = 0;
+};
+
+#endif // RESEND_BUFFER_H
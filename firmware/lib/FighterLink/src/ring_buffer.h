@@ -0,0 +1,81 @@
+/**
+ * FighterLink Lock-Free Ring Buffer
+ *
+ * Fixed-size single-producer / single-consumer queue. push() may run in an
+ * ISR or another task while pop() runs in the consumer; no locks and no
+ * allocation. Capacity must be a power of two.
+ *
+ * The producer also keeps health counters (peak depth, dropped pushes) that
+ * any context may read.
+ */
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+template <typename T, size_t N>
+class RingBuffer {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "RingBuffer capacity must be a power of two");
+
+public:
+    // Producer side. Returns false (item dropped) when full.
+    bool push(const T& item) {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        uint32_t tail = _tail.load(std::memory_order_acquire);
+        if (head - tail >= N) {
+            _overruns.store(_overruns.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return false;
+        }
+        _items[head & (N - 1)] = item;
+        _head.store(head + 1, std::memory_order_release);
+
+        uint32_t depth = head + 1 - tail;
+        if (depth > _highWater.load(std::memory_order_relaxed)) {
+            _highWater.store(depth, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    // Consumer side. Returns false when empty.
+    bool pop(T& item) {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        uint32_t head = _head.load(std::memory_order_acquire);
+        if (head == tail) {
+            return false;
+        }
+        item = _items[tail & (N - 1)];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Discards everything currently queued.
+    void clear() {
+        _tail.store(_head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    size_t size() const {
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+
+    static constexpr size_t capacity() { return N; }
+
+    // Deepest the queue has been since boot
+    uint32_t highWater() const { return _highWater.load(std::memory_order_relaxed); }
+
+    // Pushes dropped because the queue was full
+    uint32_t overruns() const { return _overruns.load(std::memory_order_relaxed); }
+
+private:
+    T _items[N];
+    std::atomic<uint32_t> _head{0};
+    std::atomic<uint32_t> _tail{0};
+    std::atomic<uint32_t> _highWater{0};
+    std::atomic<uint32_t> _overruns{0};
+};
+
+#endif // RING_BUFFER_H
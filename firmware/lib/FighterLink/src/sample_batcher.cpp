@@ -0,0 +1,169 @@
+/**
+ * FighterLink Sample Batcher
+ */
+
+#include <string.h>
+
+#include "sample_batcher.h"
+
+#define ATT_HEADER_SIZE     3
+#define MAX_RECORDS         255     // BatchHeader.count is one byte
+
+// ─── Delta Encoding ──────────────────────────────────────────────────────────
+static inline uint32_t zigzag(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static inline uint8_t* writeVarint(uint8_t* p, uint32_t v) {
+    while (v >= 0x80) {
+        *p++ = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (uint8_t)v;
+    return p;
+}
+
+static inline uint8_t* writeDelta(uint8_t* p, int16_t cur, int16_t prev) {
+    return writeVarint(p, zigzag((int32_t)cur - (int32_t)prev));
+}
+
+// ─── SampleBatcher ───────────────────────────────────────────────────────────
+SampleBatcher::SampleBatcher(uint16_t intervalUs, BatchEncoding encoding)
+    : _intervalUs(intervalUs), _encoding(encoding) {}
+
+size_t SampleBatcher::recordSize() const {
+    return _fused ? sizeof(SampleRecord) + sizeof(FusionRecord) : sizeof(SampleRecord);
+}
+
+size_t SampleBatcher::recordMaxSize() const {
+    if (_encoding == ENCODING_DELTA && _count > 0) {
+        return _fused ? FUSED_DELTA_RECORD_MAX : DELTA_RECORD_MAX;
+    }
+    return recordSize();
+}
+
+void SampleBatcher::setMtu(uint16_t mtu) {
+    size_t payload = mtu > ATT_HEADER_SIZE ? mtu - ATT_HEADER_SIZE : 0;
+    if (payload > BATCH_MAX_PAYLOAD) {
+        payload = BATCH_MAX_PAYLOAD;
+    }
+    _maxPayload = payload;
+    setEncoding(_encoding);
+}
+
+void SampleBatcher::setEncoding(BatchEncoding encoding) {
+    _encoding = encoding;
+    clear();
+
+    size_t records = 0;
+    if (_maxPayload >= _prefix + sizeof(BatchHeader) + recordSize()) {
+        size_t room = _maxPayload - _prefix - sizeof(BatchHeader) - recordSize();
+        size_t step = _encoding != ENCODING_DELTA ? recordSize()
+                      : _fused ? FUSED_DELTA_RECORD_MAX : DELTA_RECORD_MAX;
+        records = 1 + room / step;
+    }
+    if (records > MAX_RECORDS) {
+        records = MAX_RECORDS;
+    }
+
+    // A one-record batch is larger than a SensorPacket; not worth it
+    _capacity = records >= 2 ? (uint8_t)records : 0;
+}
+
+void SampleBatcher::setFused(bool fused) {
+    _fused = fused;
+    setEncoding(_encoding);
+}
+
+void SampleBatcher::setInterval(uint16_t intervalUs) {
+    _intervalUs = intervalUs;
+    clear();
+}
+
+void SampleBatcher::setScale(uint16_t accelLsbPerG, uint16_t gyroLsbPer10) {
+    _scale.frameType = FRAME_TYPE_V2;
+    _scale.version = FRAME_VERSION_2;
+    _scale.accelLsbPerG = accelLsbPerG;
+    _scale.gyroLsbPer10 = gyroLsbPer10;
+    _prefix = accelLsbPerG != 0 ? sizeof(FrameHeaderV2) : 0;
+    setEncoding(_encoding);
+}
+
+bool SampleBatcher::full() const {
+    return _count >= MAX_RECORDS || _length + recordMaxSize() > _maxPayload;
+}
+
+bool SampleBatcher::continues(uint32_t timestamp) const {
+    if (_count == 0) return true;
+    // Checked against the previous record rather than the first: the sensor
+    // ODR runs a few percent off esp_timer, which would add up over a batch
+    int32_t error = (int32_t)(timestamp - (_lastTimestamp + _intervalUs));
+    int32_t tolerance = _intervalUs / 2;
+    return error >= -tolerance && error <= tolerance;
+}
+
+void SampleBatcher::append(const SampleRecord& record, uint32_t timestamp, uint32_t sequence) {
+    int16_t axes[BATCH_SAMPLE_AXES];
+    memcpy(axes, &record, sizeof(SampleRecord));
+    appendAxes(axes, timestamp, sequence);
+}
+
+void SampleBatcher::append(const SampleRecord& record, const FusionRecord& fusion,
+                           uint32_t timestamp, uint32_t sequence) {
+    int16_t axes[BATCH_MAX_AXES];
+    memcpy(axes, &record, sizeof(SampleRecord));
+    memcpy(axes + BATCH_SAMPLE_AXES, &fusion, sizeof(FusionRecord));
+    appendAxes(axes, timestamp, sequence);
+}
+
+void SampleBatcher::appendAxes(const int16_t* axes, uint32_t timestamp, uint32_t sequence) {
+    const size_t size = recordSize();
+    const size_t count = size / sizeof(int16_t);
+    uint8_t* p = _buf + _length;
+
+    if (_count == 0) {
+        _firstTimestamp = timestamp;
+        _firstSequence = sequence;
+    }
+    _lastTimestamp = timestamp;
+
+    if (_encoding == ENCODING_DELTA && _count > 0) {
+        // Field order as in the raw record (accX..gyroZ, then the fusion fields)
+        for (size_t i = 0; i < count; i++) {
+            p = writeDelta(p, axes[i], _prev[i]);
+        }
+        _length = p - _buf;
+    } else {
+        // Raw record, or the keyframe of a delta batch
+        memcpy(p, axes, size);
+        _length += size;
+    }
+
+    memcpy(_prev, axes, size);
+    _count++;
+}
+
+size_t SampleBatcher::finish(uint8_t battery, uint8_t flags) {
+    BatchHeader header;
+    if (_fused) {
+        header.frameType = _encoding == ENCODING_DELTA ? FRAME_TYPE_FUSED_DELTA : FRAME_TYPE_FUSED;
+    } else {
+        header.frameType = _encoding == ENCODING_DELTA ? FRAME_TYPE_DELTA : FRAME_TYPE_BATCH;
+    }
+    header.count = _count;
+    header.sequence = _firstSequence;
+    header.timestamp = _firstTimestamp;
+    header.intervalUs = _intervalUs;
+    if (_count > 1) {
+        uint32_t span = _lastTimestamp - _firstTimestamp;
+        header.intervalUs = (uint16_t)((span + (_count - 1) / 2) / (_count - 1));
+    }
+    header.battery = battery;
+    header.flags = flags;
+    if (_prefix != 0) {
+        memcpy(_buf, &_scale, sizeof(FrameHeaderV2));
+    }
+    memcpy(_buf + _prefix, &header, sizeof(BatchHeader));
+
+    return _length;
+}
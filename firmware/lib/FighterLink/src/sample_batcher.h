@@ -0,0 +1,110 @@
+/**
+ * FighterLink Sample Batcher
+ *
+ * Accumulates consecutive samples into one batched frame sized to the
+ * negotiated ATT MTU, either as raw SampleRecords or delta-encoded against
+ * a per-batch keyframe. In fused mode each record also carries the
+ * orientation filter's FusionRecord, and with a scale set the frame goes
+ * out behind a FrameHeaderV2. Hardware-independent so it can be shared by
+ * every transport.
+ */
+
+#ifndef SAMPLE_BATCHER_H
+#define SAMPLE_BATCHER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sensor_packet.h"
+
+// Largest notification payload we build (ATT MTU 247 - 3 byte ATT header)
+#define BATCH_MAX_PAYLOAD   244
+
+// int16 fields per record: SampleRecord, and SampleRecord + FusionRecord
+#define BATCH_SAMPLE_AXES   (sizeof(SampleRecord) / sizeof(int16_t))
+#define BATCH_MAX_AXES      ((sizeof(SampleRecord) + sizeof(FusionRecord)) / sizeof(int16_t))
+
+// Sample encodings for batched frames
+enum BatchEncoding : uint8_t {
+    ENCODING_RAW   = 0,     // FRAME_TYPE_BATCH: 12 bytes per record
+    ENCODING_DELTA = 1,     // FRAME_TYPE_DELTA: keyframe + zigzag varint deltas
+};
+
+class SampleBatcher {
+public:
+    SampleBatcher(uint16_t intervalUs, BatchEncoding encoding = ENCODING_RAW);
+
+    // Resize for a new ATT MTU. Drops any pending samples.
+    void setMtu(uint16_t mtu);
+
+    // Switch encoding. Drops any pending samples.
+    void setEncoding(BatchEncoding encoding);
+    BatchEncoding encoding() const { return _encoding; }
+
+    // Switch between SampleRecords and SampleRecord + FusionRecord records
+    // (FRAME_TYPE_FUSED*). Drops any pending samples.
+    void setFused(bool fused);
+    bool fused() const { return _fused; }
+
+    // Change the nominal sample spacing (µs). Drops any pending samples.
+    void setInterval(uint16_t intervalUs);
+
+    // Prefix frames with a FrameHeaderV2 carrying this scale, for records
+    // in sensor LSB; accelLsbPerG 0 sends v1 frames. Drops any pending
+    // samples.
+    void setScale(uint16_t accelLsbPerG, uint16_t gyroLsbPer10);
+    bool versioned() const { return _prefix != 0; }
+
+    // Records guaranteed to fit in one frame at the current MTU, assuming
+    // worst-case deltas (0 = batching not possible)
+    uint8_t capacity() const { return _capacity; }
+
+    bool empty() const { return _count == 0; }
+
+    // True when the next record might not fit
+    bool full() const;
+
+    // True if a sample at this timestamp (µs) lands within half a nominal
+    // interval of the slot after the previous record
+    bool continues(uint32_t timestamp) const;
+
+    // Append one record; caller must check full()/continues() first, and
+    // use the overload that matches fused()
+    void append(const SampleRecord& record, uint32_t timestamp, uint32_t sequence);
+    void append(const SampleRecord& record, const FusionRecord& fusion, uint32_t timestamp,
+                uint32_t sequence);
+
+    // Fill in the header (intervalUs = measured mean spacing) and return the
+    // frame length; data() is then valid
+    size_t finish(uint8_t battery, uint8_t flags);
+
+    const uint8_t* data() const { return _buf; }
+
+    uint8_t count() const { return _count; }
+    uint32_t firstSequence() const { return _firstSequence; }
+    uint32_t firstTimestamp() const { return _firstTimestamp; }
+
+    void clear() { _count = 0; _length = _prefix + sizeof(BatchHeader); }
+
+private:
+    size_t recordSize() const;
+    size_t recordMaxSize() const;
+    void appendAxes(const int16_t* axes, uint32_t timestamp, uint32_t sequence);
+
+    uint8_t _buf[BATCH_MAX_PAYLOAD];
+    uint16_t _intervalUs;
+    BatchEncoding _encoding;
+    bool _fused = false;
+    FrameHeaderV2 _scale = {};
+    size_t _prefix = 0;             // 0 or sizeof(FrameHeaderV2)
+    size_t _maxPayload = 0;
+    size_t _length = sizeof(BatchHeader);
+    uint8_t _capacity = 0;
+    uint8_t _count = 0;
+    uint32_t _firstSequence = 0;
+    uint32_t _firstTimestamp = 0;
+    uint32_t _lastTimestamp = 0;
+    int16_t _prev[BATCH_MAX_AXES] = {};
+};
+
+#endif // SAMPLE_BATCHER_H
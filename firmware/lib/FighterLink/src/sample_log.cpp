@@ -0,0 +1,127 @@
+/**
+ * FighterLink Disconnect Log
+ */
+
+#include <string.h>
+
+#include "sample_log.h"
+
+#define RECORD_HEADER_SIZE  1       // Length byte
+#define ERASED_BYTE         0xFF
+
+// ─── SampleLog ───────────────────────────────────────────────────────────────
+bool SampleLog::begin(const char* label) {
+    _part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (!_part) return false;
+
+    uint32_t sectors = _part->size / SAMPLE_LOG_SECTOR_SIZE;
+    if (sectors > SAMPLE_LOG_MAX_SECTORS) {
+        sectors = SAMPLE_LOG_MAX_SECTORS;
+    }
+    if (sectors < 2) {
+        _part = nullptr;
+        return false;
+    }
+    _sectors = (uint16_t)sectors;
+    clear();
+    return true;
+}
+
+void SampleLog::clear() {
+    _writeSector = 0;
+    _writeOffset = 0;
+    _writeOpen = false;
+    _readSector = 0;
+    _readOffset = 0;
+    _pending = 0;
+    memset(_sectorFrames, 0, sizeof(_sectorFrames));
+}
+
+// Erase a sector for writing, dropping the oldest frames if the reader is
+// still in it
+bool SampleLog::openSector(uint16_t sector) {
+    if (_pending > 0 && sector == _readSector && sector != _writeSector) {
+        _stats.framesDropped += _sectorFrames[sector];
+        _pending -= _sectorFrames[sector];
+        _readSector = next(sector);
+        _readOffset = 0;
+    }
+    _sectorFrames[sector] = 0;
+
+    _writeSector = sector;
+    _writeOffset = 0;
+    _writeOpen = esp_partition_erase_range(_part, (size_t)sector * SAMPLE_LOG_SECTOR_SIZE,
+                                           SAMPLE_LOG_SECTOR_SIZE) == ESP_OK;
+    return _writeOpen;
+}
+
+bool SampleLog::append(const uint8_t* frame, size_t length) {
+    if (!_part || length == 0 || length > SAMPLE_LOG_MAX_FRAME) return false;
+
+    size_t need = RECORD_HEADER_SIZE + length;
+    if (!_writeOpen || _writeOffset + need > SAMPLE_LOG_SECTOR_SIZE) {
+        uint16_t target = _writeOpen ? next(_writeSector) : _writeSector;
+        if (!openSector(target)) {
+            _stats.writeErrors++;
+            return false;
+        }
+    }
+    if (_pending == 0) {
+        _readSector = _writeSector;
+        _readOffset = _writeOffset;
+    }
+
+    uint8_t record[RECORD_HEADER_SIZE + SAMPLE_LOG_MAX_FRAME];
+    record[0] = (uint8_t)length;
+    memcpy(record + RECORD_HEADER_SIZE, frame, length);
+    size_t address = (size_t)_writeSector * SAMPLE_LOG_SECTOR_SIZE + _writeOffset;
+    if (esp_partition_write(_part, address, record, need) != ESP_OK) {
+        // Don't append after a possibly torn record
+        _writeOffset = SAMPLE_LOG_SECTOR_SIZE;
+        _stats.writeErrors++;
+        return false;
+    }
+
+    _writeOffset += need;
+    _sectorFrames[_writeSector]++;
+    _pending++;
+    _stats.framesWritten++;
+    return true;
+}
+
+size_t SampleLog::pop(uint8_t* out) {
+    // Pending frames are always ahead of the reader, at most a full lap away
+    for (uint16_t skipped = 0; _pending > 0 && skipped <= _sectors; ) {
+        uint8_t length = ERASED_BYTE;
+        size_t address = (size_t)_readSector * SAMPLE_LOG_SECTOR_SIZE + _readOffset;
+        if (_readOffset + RECORD_HEADER_SIZE + 1 <= SAMPLE_LOG_SECTOR_SIZE &&
+            esp_partition_read(_part, address, &length, 1) != ESP_OK) {
+            break;
+        }
+        if (length == ERASED_BYTE || length == 0 ||
+            _readOffset + RECORD_HEADER_SIZE + length > SAMPLE_LOG_SECTOR_SIZE) {
+            // End of this sector's records
+            _readSector = next(_readSector);
+            _readOffset = 0;
+            skipped++;
+            continue;
+        }
+
+        if (esp_partition_read(_part, address + RECORD_HEADER_SIZE, out, length) != ESP_OK) {
+            break;
+        }
+        _readOffset += RECORD_HEADER_SIZE + length;
+        if (_sectorFrames[_readSector] > 0) {
+            _sectorFrames[_readSector]--;
+        }
+        _pending--;
+        return length;
+    }
+
+    // Unreadable: give up on the backlog rather than replay garbage
+    if (_pending > 0) {
+        _stats.framesDropped += _pending;
+        _pending = 0;
+    }
+    return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ * FighterLink Disconnect Log
+ *
+ * Bounded ring of batched frames in a raw flash partition (SAMPLE_LOG_PARTITION
+ * in partitions.csv). While the link is down the glove keeps sampling and
+ * appends the same delta frames it would have notified; after a reconnect the
+ * backlog is replayed oldest first on the bulk characteristic. Frames carry
+ * their own sequence numbers and timestamps, so the central merges them with
+ * the live stream by sequence.
+ *
+ * Layout: the partition is a ring of 4 KB flash sectors. Each sector holds
+ * length-prefixed records ([uint8 length][frame]) that never straddle a
+ * sector; the erased tail (0xFF) ends a sector's data. When the writer needs
+ * a sector the reader still occupies, the oldest sector is dropped.
+ *
+ * Indices live in RAM only: the log covers link drops, not reboots. Single
+ * task only (the transmission side both writes and replays).
+ */
+
+#ifndef SAMPLE_LOG_H
+#define SAMPLE_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <esp_partition.h>
+
+#include "sample_batcher.h"
+
+#define SAMPLE_LOG_SECTOR_SIZE  4096
+#define SAMPLE_LOG_MAX_SECTORS  256     // 1 MB partition
+#define SAMPLE_LOG_MAX_FRAME    BATCH_MAX_PAYLOAD
+
+struct SampleLogStats {
+    uint32_t framesWritten;     // Since boot
+    uint32_t framesDropped;     // Overwritten before they were replayed
+    uint32_t writeErrors;       // Failed flash erases/writes (frame lost)
+};
+
+class SampleLog {
+public:
+    // Find the partition and start empty. False if it is missing.
+    bool begin(const char* label);
+    bool ready() const { return _part != nullptr; }
+
+    // Append one frame (at most SAMPLE_LOG_MAX_FRAME bytes). May erase a
+    // sector first, which stalls flash access for tens of milliseconds.
+    bool append(const uint8_t* frame, size_t length);
+
+    // Copy the oldest frame into out and drop it from the log. Returns its
+    // length, 0 when the log is empty.
+    size_t pop(uint8_t* out);
+
+    bool empty() const { return _pending == 0; }
+    uint32_t pending() const { return _pending; }
+    uint32_t capacityBytes() const { return _sectors * SAMPLE_LOG_SECTOR_SIZE; }
+
+    void clear();
+
+    const SampleLogStats& stats() const { return _stats; }
+
+private:
+    bool openSector(uint16_t sector);
+    uint16_t next(uint16_t sector) const { return (sector + 1) % _sectors; }
+
+    const esp_partition_t* _part = nullptr;
+    uint16_t _sectors = 0;
+    uint16_t _writeSector = 0;
+    uint16_t _writeOffset = 0;
+    bool _writeOpen = false;        // _writeSector is erased and accepts records
+    uint16_t _readSector = 0;
+    uint16_t _readOffset = 0;
+    uint32_t _pending = 0;
+    uint16_t _sectorFrames[SAMPLE_LOG_MAX_SECTORS] = {};
+    SampleLogStats _stats = {};
+};
+
+#endif // SAMPLE_LOG_H
@@ -0,0 +1,136 @@
+/**
+ * FighterLink Fixed-Point Sample Scaling
+ *
+ * Raw MPU6050 LSB → packet units (m/s² × ACCEL_SCALE, °/s × GYRO_SCALE)
+ * without floating point; the ESP32-C3 has no FPU. Each axis is a 32×32→64
+ * multiply and a shift by a factor derived at compile time for every
+ * full-scale range (see rate_profile.h) and the packet scales. Boards with
+ * an FPU (Board::hasFpu) run the float reference itself instead.
+ *
+ * The derivation searches for a factor that reproduces the float reference,
+ * truncation included, for every int16 input. The ±16g range has none at
+ * this precision; it falls back to the nearest factor, which is off by one
+ * packet unit (0.01 m/s²) on 16 of the 65536 inputs.
+ */
+
+#ifndef SAMPLE_SCALE_H
+#define SAMPLE_SCALE_H
+
+#include <stdint.h>
+
+#include "config.h"
+#include "imu_sample.h"
+#include "rate_profile.h"
+#include "sensor_packet.h"
+
+// Fractional bits of the fixed-point factors
+#define SCALE_FIXED_SHIFT   28
+
+// ─── Float Reference ─────────────────────────────────────────────────────────
+// The original conversion, kept as the definition the fixed-point path must
+// match bit for bit, the conversion on boards with an FPU, and the "before"
+// side of the micro-benchmark.
+template <uint8_t Range>
+constexpr int32_t accelToPacketRef(int32_t lsb) {
+    return (int16_t)(lsb / ACCEL_LSB_PER_G[Range] * GRAVITY_MS2 * ACCEL_SCALE);
+}
+
+template <uint8_t Range>
+constexpr int32_t gyroToPacketRef(int32_t lsb) {
+    return (int16_t)(lsb / GYRO_LSB_PER_DPS[Range] * GYRO_SCALE);
+}
+
+// Offset-corrected LSB → packet units through the float reference, for the
+// given range codes: exact on every range, ±16g included
+static inline SampleRecord scaleSampleFloat(const ImuRawSample& lsb, uint8_t accelRange,
+                                            uint8_t gyroRange) {
+    const float accel = ACCEL_LSB_PER_G[accelRange];
+    const float gyro = GYRO_LSB_PER_DPS[gyroRange];
+    SampleRecord record;
+    record.accX = (int16_t)(lsb.accX / accel * GRAVITY_MS2 * ACCEL_SCALE);
+    record.accY = (int16_t)(lsb.accY / accel * GRAVITY_MS2 * ACCEL_SCALE);
+    record.accZ = (int16_t)(lsb.accZ / accel * GRAVITY_MS2 * ACCEL_SCALE);
+    record.gyroX = (int16_t)(lsb.gyroX / gyro * GYRO_SCALE);
+    record.gyroY = (int16_t)(lsb.gyroY / gyro * GYRO_SCALE);
+    record.gyroZ = (int16_t)(lsb.gyroZ / gyro * GYRO_SCALE);
+    return record;
+}
+
+// ─── Factor Derivation ───────────────────────────────────────────────────────
+struct ScaleFactor {
+    uint32_t factor;
+    bool exact;         // Bit-exact against the reference for all int16
+};
+
+// Smallest K with (n * K) >> SCALE_FIXED_SHIFT == ref(n) for n in 1..32768.
+// The reference is odd-symmetric (IEEE rounding and truncation both are), so
+// magnitudes cover negative inputs too. If no such K exists, falls back to
+// the nearest factor to unitsPerLsb.
+constexpr ScaleFactor deriveScaleFactor(int32_t (*ref)(int32_t), float unitsPerLsb) {
+    uint64_t lo = 0;
+    uint64_t hi = UINT64_MAX;
+    for (uint64_t n = 1; n <= 32768; n++) {
+        uint64_t r = (uint64_t)ref((int32_t)n);
+        uint64_t first = ((r << SCALE_FIXED_SHIFT) + n - 1) / n;
+        uint64_t last = (((r + 1) << SCALE_FIXED_SHIFT) + n - 1) / n - 1;
+        lo = first > lo ? first : lo;
+        hi = last < hi ? last : hi;
+    }
+    if (lo <= hi && lo <= UINT32_MAX) {
+        return {(uint32_t)lo, true};
+    }
+    return {(uint32_t)((double)unitsPerLsb * (1ull << SCALE_FIXED_SHIFT) + 0.5), false};
+}
+
+template <uint8_t Range>
+constexpr ScaleFactor accelScaleFactor() {
+    return deriveScaleFactor(accelToPacketRef<Range>,
+                             GRAVITY_MS2 * ACCEL_SCALE / ACCEL_LSB_PER_G[Range]);
+}
+
+template <uint8_t Range>
+constexpr ScaleFactor gyroScaleFactor() {
+    return deriveScaleFactor(gyroToPacketRef<Range>, GYRO_SCALE / GYRO_LSB_PER_DPS[Range]);
+}
+
+// Indexed by ACCEL_RANGE_* / GYRO_RANGE_*
+constexpr ScaleFactor ACCEL_SCALE_FACTORS[SENSOR_RANGE_COUNT] = {
+    accelScaleFactor<ACCEL_RANGE_2G>(),
+    accelScaleFactor<ACCEL_RANGE_4G>(),
+    accelScaleFactor<ACCEL_RANGE_8G>(),
+    accelScaleFactor<ACCEL_RANGE_16G>(),
+};
+
+constexpr ScaleFactor GYRO_SCALE_FACTORS[SENSOR_RANGE_COUNT] = {
+    gyroScaleFactor<GYRO_RANGE_250DPS>(),
+    gyroScaleFactor<GYRO_RANGE_500DPS>(),
+    gyroScaleFactor<GYRO_RANGE_1000DPS>(),
+    gyroScaleFactor<GYRO_RANGE_2000DPS>(),
+};
+
+// The legacy 100Hz ranges must stay bit-exact
+static_assert(ACCEL_SCALE_FACTORS[ACCEL_RANGE_2G].exact, "±2g accel factor is not bit-exact");
+static_assert(GYRO_SCALE_FACTORS[GYRO_RANGE_500DPS].exact, "±500°/s gyro factor is not bit-exact");
+
+// ─── Fixed-Point Conversion ──────────────────────────────────────────────────
+static inline int16_t scaleFixed(int16_t lsb, uint32_t factor) {
+    uint32_t mag = lsb < 0 ? (uint32_t)(-(int32_t)lsb) : (uint32_t)lsb;
+    int32_t value = (int32_t)(((uint64_t)mag * factor) >> SCALE_FIXED_SHIFT);
+    return (int16_t)(lsb < 0 ? -value : value);
+}
+
+// Offset-corrected LSB → packet units for the given range codes
+static inline SampleRecord scaleSample(const ImuRawSample& lsb, uint8_t accelRange, uint8_t gyroRange) {
+    const uint32_t accel = ACCEL_SCALE_FACTORS[accelRange].factor;
+    const uint32_t gyro = GYRO_SCALE_FACTORS[gyroRange].factor;
+    SampleRecord record;
+    record.accX = scaleFixed(lsb.accX, accel);
+    record.accY = scaleFixed(lsb.accY, accel);
+    record.accZ = scaleFixed(lsb.accZ, accel);
+    record.gyroX = scaleFixed(lsb.gyroX, gyro);
+    record.gyroY = scaleFixed(lsb.gyroY, gyro);
+    record.gyroZ = scaleFixed(lsb.gyroZ, gyro);
+    return record;
+}
+
+#endif // SAMPLE_SCALE_H
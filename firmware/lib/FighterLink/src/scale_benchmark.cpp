@@ -0,0 +1,97 @@
+/**
+ * FighterLink Scaling Micro-Benchmark
+ *
+ * See scale_benchmark.h. Timing uses the CPU cycle counter over a block of
+ * pseudo-random samples and keeps the best of several runs to filter out
+ * interrupts.
+ */
+
+#if SCALE_BENCHMARK
+
+#include <Arduino.h>
+
+#include "sample_scale.h"
+#include "scale_benchmark.h"
+
+#define BENCH_SAMPLES   256
+#define BENCH_RUNS      8
+
+static int16_t s_input[BENCH_SAMPLES][6];
+static volatile int16_t s_sink;
+
+static void fillInput() {
+    uint32_t seed = 0x12345678;
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        for (int axis = 0; axis < 6; axis++) {
+            seed = seed * 1664525 + 1013904223;  // LCG
+            s_input[i][axis] = (int16_t)(seed >> 16);
+        }
+    }
+}
+
+// Best-of-N cycles for one pass over the block, per sample
+template <typename Convert>
+static uint32_t cyclesPerSample(Convert convert) {
+    uint32_t best = UINT32_MAX;
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        uint32_t start = ESP.getCycleCount();
+        for (int i = 0; i < BENCH_SAMPLES; i++) {
+            const int16_t* s = s_input[i];
+            s_sink = convert(s[0], true);
+            s_sink = convert(s[1], true);
+            s_sink = convert(s[2], true);
+            s_sink = convert(s[3], false);
+            s_sink = convert(s[4], false);
+            s_sink = convert(s[5], false);
+        }
+        uint32_t elapsed = ESP.getCycleCount() - start;
+        if (elapsed < best) best = elapsed;
+    }
+    return best / BENCH_SAMPLES;
+}
+
+// int16 inputs whose fixed-point result differs from the reference
+template <typename Ref>
+static uint32_t countMismatches(Ref ref, uint32_t factor) {
+    uint32_t mismatches = 0;
+    for (int32_t n = INT16_MIN; n <= INT16_MAX; n++) {
+        if (scaleFixed((int16_t)n, factor) != ref(n)) mismatches++;
+    }
+    return mismatches;
+}
+
+void runScaleBenchmark() {
+    static int32_t (* const accelRefs[SENSOR_RANGE_COUNT])(int32_t) = {
+        accelToPacketRef<ACCEL_RANGE_2G>, accelToPacketRef<ACCEL_RANGE_4G>,
+        accelToPacketRef<ACCEL_RANGE_8G>, accelToPacketRef<ACCEL_RANGE_16G>,
+    };
+    static int32_t (* const gyroRefs[SENSOR_RANGE_COUNT])(int32_t) = {
+        gyroToPacketRef<GYRO_RANGE_250DPS>, gyroToPacketRef<GYRO_RANGE_500DPS>,
+        gyroToPacketRef<GYRO_RANGE_1000DPS>, gyroToPacketRef<GYRO_RANGE_2000DPS>,
+    };
+    
+    fillInput();
+    uint32_t floatCycles = cyclesPerSample([](int16_t lsb, bool accel) {
+        return (int16_t)(accel ? accelToPacketRef<ACCEL_RANGE_2G>(lsb)
+                               : gyroToPacketRef<GYRO_RANGE_500DPS>(lsb));
+    });
+    uint32_t fixedCycles = cyclesPerSample([](int16_t lsb, bool accel) {
+        return scaleFixed(lsb, accel ? ACCEL_SCALE_FACTORS[ACCEL_RANGE_2G].factor
+                                     : GYRO_SCALE_FACTORS[GYRO_RANGE_500DPS].factor);
+    });
+    
+    Serial.println("Scale bench: LSB -> packet units, 6 axes per sample");
+    Serial.printf("Scale bench: float %u cycles/sample, fixed %u cycles/sample\n",
+                  (unsigned)floatCycles, (unsigned)fixedCycles);
+    for (int range = 0; range < SENSOR_RANGE_COUNT; range++) {
+        const ScaleFactor& accel = ACCEL_SCALE_FACTORS[range];
+        const ScaleFactor& gyro = GYRO_SCALE_FACTORS[range];
+        Serial.printf("Scale bench: ±%dg factor %u, %u mismatches | ±%d°/s factor %u, %u mismatches\n",
+                      2 << range, (unsigned)accel.factor,
+                      (unsigned)countMismatches(accelRefs[range], accel.factor),
+                      250 << range, (unsigned)gyro.factor,
+                      (unsigned)countMismatches(gyroRefs[range], gyro.factor));
+    }
+}
+
+#endif // SCALE_BENCHMARK
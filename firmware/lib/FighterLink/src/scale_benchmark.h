@@ -0,0 +1,15 @@
+/**
+ * FighterLink Scaling Micro-Benchmark
+ *
+ * Built only with -DSCALE_BENCHMARK=1 (pio run -e bench_scale). At boot it
+ * checks the fixed-point conversion against the float reference for every
+ * int16 input in each full-scale range, then prints CPU cycles per 6-axis
+ * sample for both paths.
+ */
+
+#ifndef SCALE_BENCHMARK_H
+#define SCALE_BENCHMARK_H
+
+void runScaleBenchmark();
+
+#endif // SCALE_BENCHMARK_H
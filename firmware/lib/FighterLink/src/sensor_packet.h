@@ -0,0 +1,378 @@
+/**
+ * FighterLink Sensor Packet Definition
+ * 
+ * 20-byte binary packet structure for BLE transmission.
+ * This header is shared between firmware (C++) and should match
+ * the Go server's packet parsing exactly.
+ */
+
+#ifndef SENSOR_PACKET_H
+#define SENSOR_PACKET_H
+
+#include <stdint.h>
+
+/**
+ * Binary sensor packet structure (20 bytes total)
+ * 
+ * All multi-byte values are little-endian (native for ESP32 and x86/ARM)
+ * 
+ * Field      | Offset | Size | Type   | Scale  | Units
+ * -----------|--------|------|--------|--------|-------
+ * accX       | 0      | 2    | int16  | ÷100   | m/s²
+ * accY       | 2      | 2    | int16  | ÷100   | m/s²
+ * accZ       | 4      | 2    | int16  | ÷100   | m/s²
+ * gyroX      | 6      | 2    | int16  | ÷10    | °/s
+ * gyroY      | 8      | 2    | int16  | ÷10    | °/s
+ * gyroZ      | 10     | 2    | int16  | ÷10    | °/s
+ * timestamp  | 12     | 4    | uint32 | -      | µs (see clock_sync.h)
+ * sequence   | 16     | 2    | uint16 | -      | counter, low 16 bits
+ * battery    | 18     | 1    | uint8  | -      | 0-100%
+ * flags      | 19     | 1    | uint8  | -      | bitfield
+ * 
+ * Flags bitfield:
+ *   Bit 0: isCharging (1 = charging, 0 = on battery)
+ *   Bit 1: isCalibrated (1 = calibration complete)
+ *   Bit 2: isIdle (1 = idle rate tier, ADAPTIVE_RATE_ENABLED)
+ *   Bit 3-7: Reserved
+ */
+struct __attribute__((packed)) SensorPacket {
+    int16_t  accX;       // Accelerometer X (m/s² * 100)
+    int16_t  accY;       // Accelerometer Y (m/s² * 100)
+    int16_t  accZ;       // Accelerometer Z (m/s² * 100)
+    int16_t  gyroX;      // Gyroscope X (°/s * 10)
+    int16_t  gyroY;      // Gyroscope Y (°/s * 10)
+    int16_t  gyroZ;      // Gyroscope Z (°/s * 10)
+    uint32_t timestamp;  // esp_timer µs (wraps every ~71.6 min)
+    uint16_t sequence;   // Low 16 bits of the sample sequence (receivers extend it)
+    uint8_t  battery;    // Battery percentage (0-100)
+    uint8_t  flags;      // Status flags
+};
+
+// Compile-time size check
+static_assert(sizeof(SensorPacket) == 20, "SensorPacket must be exactly 20 bytes");
+
+/**
+ * Batched sample frame (14-byte header + N × 12-byte records)
+ *
+ * Packs several consecutive samples into one notification so the ATT/L2CAP
+ * overhead is paid once per batch instead of once per sample. N is sized to
+ * the negotiated ATT MTU. A batch is never 20 bytes long, so the receiver
+ * tells it apart from a legacy SensorPacket by length and frameType.
+ *
+ * Sample i has sequence = header.sequence + i and
+ * timestamp = header.timestamp + i * header.intervalUs, where intervalUs is
+ * the mean spacing measured over the batch (the sensor clock and esp_timer
+ * disagree by up to a few percent, so the nominal period would drift).
+ * Unlike SensorPacket, the batch carries the full 32-bit sequence, which
+ * doesn't wrap within a session, so resends (resend_buffer.h) stay
+ * unambiguous.
+ *
+ * Field      | Offset | Size | Type   | Notes
+ * -----------|--------|------|--------|---------------------------
+ * frameType  | 0      | 1    | uint8  | FRAME_TYPE_BATCH
+ * count      | 1      | 1    | uint8  | records that follow (N)
+ * sequence   | 2      | 4    | uint32 | sequence of record 0
+ * timestamp  | 6      | 4    | uint32 | µs, timestamp of record 0
+ * intervalUs | 10     | 2    | uint16 | µs between records
+ * battery    | 12     | 1    | uint8  | 0-100%
+ * flags      | 13     | 1    | uint8  | same bitfield as SensorPacket
+ * records    | 14     | 12×N | SampleRecord
+ */
+#define FRAME_TYPE_BATCH    0xB1
+
+struct __attribute__((packed)) BatchHeader {
+    uint8_t  frameType;  // FRAME_TYPE_BATCH
+    uint8_t  count;      // Number of SampleRecords that follow
+    uint32_t sequence;   // Sequence number of the first record
+    uint32_t timestamp;  // Timestamp of the first record (µs)
+    uint16_t intervalUs; // Spacing between records (µs)
+    uint8_t  battery;    // Battery percentage (0-100)
+    uint8_t  flags;      // Status flags
+};
+
+// One sample inside a batch - same units as SensorPacket
+struct __attribute__((packed)) SampleRecord {
+    int16_t  accX;       // Accelerometer X (m/s² * 100)
+    int16_t  accY;       // Accelerometer Y (m/s² * 100)
+    int16_t  accZ;       // Accelerometer Z (m/s² * 100)
+    int16_t  gyroX;      // Gyroscope X (°/s * 10)
+    int16_t  gyroY;      // Gyroscope Y (°/s * 10)
+    int16_t  gyroZ;      // Gyroscope Z (°/s * 10)
+};
+
+static_assert(sizeof(BatchHeader) == 14, "BatchHeader must be exactly 14 bytes");
+static_assert(sizeof(SampleRecord) == 12, "SampleRecord must be exactly 12 bytes");
+
+// One sample as a legacy packet; the sequence keeps its low 16 bits
+static inline SensorPacket makeSensorPacket(const SampleRecord& record, uint32_t timestamp,
+                                            uint32_t sequence, uint8_t battery, uint8_t flags) {
+    SensorPacket packet;
+    packet.accX = record.accX;
+    packet.accY = record.accY;
+    packet.accZ = record.accZ;
+    packet.gyroX = record.gyroX;
+    packet.gyroY = record.gyroY;
+    packet.gyroZ = record.gyroZ;
+    packet.timestamp = timestamp;
+    packet.sequence = (uint16_t)sequence;
+    packet.battery = battery;
+    packet.flags = flags;
+    return packet;
+}
+
+/**
+ * Delta-encoded batch frame (14-byte header + keyframe + packed deltas)
+ *
+ * Same BatchHeader as above with frameType = FRAME_TYPE_DELTA. Record 0 is
+ * sent as a raw SampleRecord keyframe; every following record is six
+ * per-axis deltas against the previous record (accX..gyroZ order), each
+ * zigzag-mapped and written as an unsigned LEB128 varint:
+ *
+ *   zigzag(d) = (d << 1) ^ (d >> 31)          // 0,-1,1,-2 → 0,1,2,3
+ *   varint    = 7 bits per byte, low bits first, bit 7 = "more follows"
+ *
+ * A still glove costs 6 bytes per sample instead of 12; a full-scale swing
+ * costs at most 18. Sequence and timestamp are implied by position exactly
+ * as in the raw batch.
+ */
+#define FRAME_TYPE_DELTA    0xB2
+
+// Worst-case encoded size of one delta record (six 3-byte varints)
+#define DELTA_RECORD_MAX    18
+
+/**
+ * Fused batch frames (STREAM_MODE_FUSED)
+ *
+ * Same BatchHeader and sample spacing as the frames above, but each record
+ * is a SampleRecord followed by the on-glove orientation filter's output
+ * for that sample (orientation_filter.h): 13 int16 fields, 26 bytes.
+ * FRAME_TYPE_FUSED sends them raw; FRAME_TYPE_FUSED_DELTA sends record 0 as
+ * a raw 26-byte keyframe and the rest as 13 zigzag varint deltas each, in
+ * the order accX..gyroZ, quatW..quatZ, linAccX..linAccZ.
+ *
+ * Field      | Offset | Size | Type  | Scale  | Units
+ * -----------|--------|------|-------|--------|-------
+ * sample     | 0      | 12   | SampleRecord
+ * quatW..Z   | 12     | 8    | int16 | ÷16384 | unit quaternion, sensor → world
+ * linAccX..Z | 20     | 6    | int16 | ÷100   | m/s², gravity removed (sensor frame)
+ *
+ * World Z is up; heading is gyro-only and drifts, tilt does not.
+ */
+#define FRAME_TYPE_FUSED        0xB3
+#define FRAME_TYPE_FUSED_DELTA  0xB4
+
+#define QUAT_SCALE          16384   // Q14 quaternion components
+
+struct __attribute__((packed)) FusionRecord {
+    int16_t  quatW;      // Orientation quaternion (Q14)
+    int16_t  quatX;
+    int16_t  quatY;
+    int16_t  quatZ;
+    int16_t  linAccX;    // Linear acceleration (m/s² * 100, gravity removed)
+    int16_t  linAccY;
+    int16_t  linAccZ;
+};
+
+static_assert(sizeof(FusionRecord) == 14, "FusionRecord must be exactly 14 bytes");
+
+// Worst-case encoded size of one fused delta record (thirteen 3-byte varints)
+#define FUSED_DELTA_RECORD_MAX  39
+
+/**
+ * Version 2 frame header (6 bytes, FRAME_FORMAT_LSB)
+ *
+ * Packet units cost resolution: 0.01 m/s² is 17 LSB at ±2g, and 0.1 °/s is
+ * 13 LSB at ±250°/s. A v2 frame is this header followed by any batched
+ * frame above, whose SampleRecord fields are then offset-corrected sensor
+ * LSB, with the scale to convert them. FusionRecord fields keep their own
+ * units. Legacy SensorPackets, punch records and logged frames stay v1.
+ *
+ * Field         | Offset | Size | Type   | Notes
+ * --------------|--------|------|--------|---------------------------
+ * frameType     | 0      | 1    | uint8  | FRAME_TYPE_V2
+ * version       | 1      | 1    | uint8  | FRAME_VERSION_2
+ * accelLsbPerG  | 2      | 2    | uint16 | LSB per g (16384 at ±2g)
+ * gyroLsbPer10  | 4      | 2    | uint16 | LSB per 10 °/s (1310 at ±250°/s)
+ * frame         | 6      | -    | BatchHeader + records
+ */
+#define FRAME_TYPE_V2       0xB5
+#define FRAME_VERSION_2     2
+
+struct __attribute__((packed)) FrameHeaderV2 {
+    uint8_t  frameType;     // FRAME_TYPE_V2
+    uint8_t  version;       // FRAME_VERSION_2
+    uint16_t accelLsbPerG;  // Accelerometer sensitivity
+    uint16_t gyroLsbPer10;  // Gyroscope sensitivity, LSB per 10 °/s
+};
+
+static_assert(sizeof(FrameHeaderV2) == 6, "FrameHeaderV2 must be exactly 6 bytes");
+
+/**
+ * Punch event record (14 bytes) - event-only streaming mode
+ *
+ * The glove runs punch detection itself and notifies one record per punch
+ * instead of streaming raw samples. A record with punchType PUNCH_TYPE_NONE
+ * is a heartbeat that keeps battery/flags fresh and the link alive between
+ * punches; count always carries the latest punch number so the receiver
+ * can spot lost events.
+ *
+ * Field        | Offset | Size | Type   | Scale  | Units
+ * -------------|--------|------|--------|--------|-------
+ * frameType    | 0      | 1    | uint8  | -      | FRAME_TYPE_PUNCH
+ * punchType    | 1      | 1    | uint8  | -      | PUNCH_TYPE_*
+ * count        | 2      | 2    | uint16 | -      | punch number since boot
+ * peakForce    | 4      | 2    | uint16 | ÷100   | m/s² (gravity removed)
+ * peakRotation | 6      | 2    | uint16 | ÷10    | °/s, peak |gyroZ|
+ * timestamp    | 8      | 4    | uint32 | -      | µs, threshold crossing
+ * battery      | 12     | 1    | uint8  | -      | 0-100%
+ * flags        | 13     | 1    | uint8  | -      | bitfield
+ */
+#define FRAME_TYPE_PUNCH    0xC1
+
+#define PUNCH_TYPE_NONE     0   // Heartbeat, no punch
+#define PUNCH_TYPE_STRAIGHT 1
+#define PUNCH_TYPE_HOOK     2
+#define PUNCH_TYPE_UPPERCUT 3
+#define PUNCH_TYPE_UNKNOWN  4
+
+struct __attribute__((packed)) PunchEventPacket {
+    uint8_t  frameType;     // FRAME_TYPE_PUNCH
+    uint8_t  punchType;     // PUNCH_TYPE_*
+    uint16_t count;         // Punch number since boot
+    uint16_t peakForce;     // Peak force (m/s² * 100)
+    uint16_t peakRotation;  // Peak |gyroZ| (°/s * 10)
+    uint32_t timestamp;     // Threshold crossing (µs)
+    uint8_t  battery;       // Battery percentage (0-100)
+    uint8_t  flags;         // Status flags
+};
+
+static_assert(sizeof(PunchEventPacket) == 14, "PunchEventPacket must be exactly 14 bytes");
+
+/**
+ * Punch feature record (24 bytes) - event-only streaming mode
+ *
+ * Replaces PunchEventPacket for punches when the link MTU fits it, with the
+ * features reduced from the samples around the crossing (punch_features.h).
+ * Heartbeats stay PunchEventPacket. The size is chosen not to collide with
+ * the legacy 20-byte SensorPacket.
+ *
+ * Field        | Offset | Size | Type   | Scale  | Units
+ * -------------|--------|------|--------|--------|-------
+ * frameType    | 0      | 1    | uint8  | -      | FRAME_TYPE_PUNCH_FEATURES
+ * punchType    | 1      | 1    | uint8  | -      | PUNCH_TYPE_*
+ * count        | 2      | 2    | uint16 | -      | punch number since boot
+ * timestamp    | 4      | 4    | uint32 | -      | µs, threshold crossing
+ * peakForce    | 8      | 2    | uint16 | ÷100   | m/s², peak |linear accel|
+ * impulse      | 10     | 2    | uint16 | ÷100   | m/s, |linear accel| over the impact
+ * peakGyroX    | 12     | 2    | int16  | ÷10    | °/s, signed peak
+ * peakGyroY    | 14     | 2    | int16  | ÷10    | °/s
+ * peakGyroZ    | 16     | 2    | int16  | ÷10    | °/s
+ * duration     | 18     | 2    | uint16 | ÷10    | ms, impact above PUNCH_IMPACT_MS2
+ * retraction   | 20     | 2    | uint16 | ÷10    | ms, peak → strongest pull-back
+ * battery      | 22     | 1    | uint8  | -      | 0-100%
+ * flags        | 23     | 1    | uint8  | -      | bitfield
+ */
+#define FRAME_TYPE_PUNCH_FEATURES   0xC2
+
+struct __attribute__((packed)) PunchFeaturePacket {
+    uint8_t  frameType;     // FRAME_TYPE_PUNCH_FEATURES
+    uint8_t  punchType;     // PUNCH_TYPE_*
+    uint16_t count;         // Punch number since boot
+    uint32_t timestamp;     // Threshold crossing (µs)
+    uint16_t peakForce;     // Peak linear acceleration (m/s² * 100)
+    uint16_t impulse;       // Integrated linear acceleration (m/s * 100)
+    int16_t  peakGyroX;     // Signed peak rotation rate (°/s * 10)
+    int16_t  peakGyroY;
+    int16_t  peakGyroZ;
+    uint16_t duration;      // Impact duration (ms * 10)
+    uint16_t retraction;    // Peak to pull-back (ms * 10)
+    uint8_t  battery;       // Battery percentage (0-100)
+    uint8_t  flags;         // Status flags
+};
+
+static_assert(sizeof(PunchFeaturePacket) == 24, "PunchFeaturePacket must be exactly 24 bytes");
+
+/**
+ * Latency trace frame (9 bytes)
+ *
+ * Once the central asks for it (CONTROL_OP_LATENCY, stream_control.h),
+ * every Nth frame on the sensor characteristic is followed by one of
+ * these: when the newest sample (or punch crossing) in that frame was
+ * captured, and when the frame was handed to the BLE stack. The central
+ * adds its own arrival time and places both on its clock. Not logged,
+ * resent or broadcast.
+ *
+ * Field        | Offset | Size | Type   | Units
+ * -------------|--------|------|--------|------------------------------
+ * frameType    | 0      | 1    | uint8  | FRAME_TYPE_LATENCY
+ * captureTime  | 1      | 4    | uint32 | µs, the traced frame's (first sample's) timestamp
+ * queuedTime   | 5      | 4    | uint32 | µs, just before its notify()
+ */
+#define FRAME_TYPE_LATENCY  0xD1
+
+struct __attribute__((packed)) LatencyTraceFrame {
+    uint8_t  frameType;     // FRAME_TYPE_LATENCY
+    uint32_t captureTime;   // First sample / punch crossing of the traced frame (µs)
+    uint32_t queuedTime;    // Traced frame handed to the stack (µs)
+};
+
+static_assert(sizeof(LatencyTraceFrame) == 9, "LatencyTraceFrame must be exactly 9 bytes");
+
+/**
+ * Broadcast header (6 bytes, BROADCAST_ENABLED)
+ *
+ * A broadcasting glove advertises its complete local name followed by one
+ * manufacturer-specific AD structure: this header, then the frame it would
+ * have notified on the sensor characteristic, byte for byte. The counter
+ * advances with every frame so a receiver can drop repeated advertisements
+ * of the same one.
+ *
+ * Field      | Offset | Size | Type   | Notes
+ * -----------|--------|------|--------|-------
+ * companyId  | 0      | 2    | uint16 | BROADCAST_COMPANY_ID
+ * version    | 2      | 1    | uint8  | BROADCAST_VERSION
+ * athlete    | 3      | 1    | uint8  | BROADCAST_ATHLETE_ID
+ * hand       | 4      | 1    | uint8  | HAND_LEFT / HAND_RIGHT (device characteristic)
+ * counter    | 5      | 1    | uint8  | frame counter, wraps
+ */
+#define BROADCAST_COMPANY_ID    0xFFFF  // Bluetooth SIG: no company (testing/internal use)
+#define BROADCAST_VERSION       1
+
+struct __attribute__((packed)) BroadcastHeader {
+    uint16_t companyId;     // BROADCAST_COMPANY_ID
+    uint8_t  version;       // BROADCAST_VERSION
+    uint8_t  athlete;       // Athlete the glove belongs to
+    uint8_t  hand;          // Hand ID, as on the device characteristic
+    uint8_t  counter;       // Frame counter
+};
+
+static_assert(sizeof(BroadcastHeader) == 6, "BroadcastHeader must be exactly 6 bytes");
+
+/**
+ * USB frame header (5 bytes, USB_TRANSPORT_ENABLED)
+ *
+ * Over USB every frame the glove would have notified on the sensor
+ * characteristic, byte for byte, follows this header and is followed by a
+ * CRC-16/CCITT-FALSE (little-endian) over hand, length and frame. Status
+ * text shares the port between frames; 0xFE never occurs in UTF-8, so a
+ * reader resyncs on it. The host writes control-characteristic values in
+ * the same framing (hand ignored).
+ *
+ * Field      | Offset | Size | Type   | Notes
+ * -----------|--------|------|--------|-------
+ * sync       | 0      | 2    | uint8  | USB_FRAME_SYNC0, USB_FRAME_SYNC1
+ * hand       | 2      | 1    | uint8  | HAND_LEFT / HAND_RIGHT (device characteristic)
+ * length     | 3      | 2    | uint16 | frame bytes, at most USB_FRAME_MAX_PAYLOAD
+ */
+#define USB_FRAME_SYNC0         0xFE
+#define USB_FRAME_SYNC1         0x4C    // 'L'
+
+struct __attribute__((packed)) UsbFrameHeader {
+    uint8_t  sync[2];       // USB_FRAME_SYNC0, USB_FRAME_SYNC1
+    uint8_t  hand;          // Hand ID, as on the device characteristic
+    uint16_t length;        // Frame bytes after the header, CRC excluded
+};
+
+static_assert(sizeof(UsbFrameHeader) == 5, "UsbFrameHeader must be exactly 5 bytes");
+
+#endif // SENSOR_PACKET_H
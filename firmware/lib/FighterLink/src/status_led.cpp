@@ -0,0 +1,101 @@
+/**
+ * FighterLink Status LED
+ */
+
+#include <Arduino.h>
+#include <atomic>
+#include <esp_timer.h>
+
+#include "board_traits.h"
+#include "config.h"
+#include "status_led.h"
+
+// ─── Patterns ────────────────────────────────────────────────────────────────
+struct PatternDef {
+    uint16_t onMs;
+    uint16_t offMs;
+    uint8_t pulses;     // 0 = repeat
+};
+
+static const PatternDef PATTERNS[LED_PATTERN_COUNT] = {
+    {0, 1, 0},                                          // OFF
+    {1, 0, 0},                                          // ON
+    {LED_BLINK_SLOW_MS / 2, LED_BLINK_SLOW_MS / 2, 0},  // SLOW
+    {LED_BLINK_FAST_MS / 2, LED_BLINK_FAST_MS / 2, 0},  // FAST
+    {2000, 2000, 0},                                    // CHARGING
+    {100, 100, 0},                                      // ERROR
+    {100, 100, 2},                                      // DOUBLE
+    {100, 100, 3},                                      // TRIPLE
+};
+
+// ─── State ───────────────────────────────────────────────────────────────────
+static esp_timer_handle_t s_timer = nullptr;
+static std::atomic<uint8_t> s_background{LED_PATTERN_OFF};
+static std::atomic<uint8_t> s_flash{LED_PATTERN_COUNT};    // COUNT = none
+static std::atomic<uint32_t> s_backgroundStart{0};
+static std::atomic<uint32_t> s_flashStart{0};
+static bool s_level = false;    // Timer callback only
+
+// ─── Output ──────────────────────────────────────────────────────────────────
+static void writeLed(bool on) {
+    digitalWrite(Board::pinLed, on != Board::ledActiveLow ? HIGH : LOW);
+    s_level = on;
+}
+
+static bool levelAt(const PatternDef& p, uint32_t elapsed) {
+    if (p.offMs == 0) return true;
+    return p.onMs > 0 && elapsed % (p.onMs + p.offMs) < p.onMs;
+}
+
+static void onTick(void*) {
+    uint32_t now = millis();
+    bool on;
+
+    uint8_t flash = s_flash.load();
+    uint32_t flashElapsed = now - s_flashStart.load();
+    if (flash < LED_PATTERN_COUNT &&
+        flashElapsed < PATTERNS[flash].pulses * (uint32_t)(PATTERNS[flash].onMs + PATTERNS[flash].offMs)) {
+        on = levelAt(PATTERNS[flash], flashElapsed);
+    } else {
+        s_flash.store(LED_PATTERN_COUNT);
+        on = levelAt(PATTERNS[s_background.load()], now - s_backgroundStart.load());
+    }
+    if (on != s_level) {
+        writeLed(on);
+    }
+}
+
+// ─── Public API ──────────────────────────────────────────────────────────────
+void ledBegin() {
+    pinMode(Board::pinLed, OUTPUT);
+    writeLed(false);
+
+    const esp_timer_create_args_t args = {
+        .callback = onTick,
+        .arg = nullptr,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "led",
+        .skip_unhandled_events = true,
+    };
+    if (esp_timer_create(&args, &s_timer) == ESP_OK) {
+        esp_timer_start_periodic(s_timer, LED_TICK_MS * 1000ULL);
+    }
+}
+
+void ledSet(LedPattern pattern) {
+    if (pattern == s_background.load()) return;     // Keep the blink phase
+    s_backgroundStart.store(millis());
+    s_background.store(pattern);
+}
+
+void ledFlash(LedPattern pattern) {
+    s_flashStart.store(millis());
+    s_flash.store(pattern);
+}
+
+void ledStop() {
+    if (s_timer) {
+        esp_timer_stop(s_timer);
+    }
+    writeLed(false);
+}
@@ -0,0 +1,39 @@
+/**
+ * FighterLink Status LED
+ *
+ * Indicator patterns run off an esp_timer tick, so no caller ever waits on
+ * a blink. A background pattern shows the device state; a one-shot flash
+ * (double/triple blink) plays over it and then hands the LED back. Setters
+ * only store the pattern and return: safe from any task.
+ */
+
+#ifndef STATUS_LED_H
+#define STATUS_LED_H
+
+#include <stdint.h>
+
+enum LedPattern : uint8_t {
+    LED_PATTERN_OFF = 0,
+    LED_PATTERN_ON,         // Connected, streaming
+    LED_PATTERN_SLOW,       // Initializing / calibrating
+    LED_PATTERN_FAST,       // Advertising
+    LED_PATTERN_CHARGING,
+    LED_PATTERN_ERROR,
+    LED_PATTERN_DOUBLE,     // One-shot: session event acknowledgment
+    LED_PATTERN_TRIPLE,     // One-shot: calibration complete
+    LED_PATTERN_COUNT
+};
+
+// Configure the board LED and start the pattern timer (LED off)
+void ledBegin();
+
+// Background pattern, shown until the next call
+void ledSet(LedPattern pattern);
+
+// Play a one-shot pattern over the background one
+void ledFlash(LedPattern pattern);
+
+// Turn the LED off now and stop the timer (before deep sleep)
+void ledStop();
+
+#endif // STATUS_LED_H
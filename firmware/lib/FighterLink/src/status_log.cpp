@@ -0,0 +1,55 @@
+/**
+ * FighterLink Status Log
+ */
+
+#include <Arduino.h>
+#include <atomic>
+#include <stdarg.h>
+
+#include "config.h"
+#include "status_log.h"
+
+struct StatusLine {
+    char text[STATUS_LOG_LINE];
+};
+
+// ─── State ───────────────────────────────────────────────────────────────────
+static QueueHandle_t s_queue = nullptr;
+static std::atomic<uint32_t> s_dropped{0};
+
+// ─── Writer Task ─────────────────────────────────────────────────────────────
+static void statusLogTask(void* param) {
+    StatusLine line;
+    for (;;) {
+        if (xQueueReceive(s_queue, &line, portMAX_DELAY) != pdTRUE) continue;
+
+        uint32_t dropped = s_dropped.exchange(0);
+        if (dropped > 0) {
+            Serial.printf("Log: %u status lines dropped\n", (unsigned)dropped);
+        }
+        Serial.print(line.text);
+    }
+}
+
+// ─── Public API ──────────────────────────────────────────────────────────────
+void statusLogBegin() {
+    s_queue = xQueueCreate(STATUS_LOG_DEPTH, sizeof(StatusLine));
+    xTaskCreate(statusLogTask, "log", STATUS_LOG_TASK_STACK, nullptr,
+                STATUS_LOG_TASK_PRIORITY, nullptr);
+}
+
+void statusLog(const char* format, ...) {
+    StatusLine line;
+    va_list args;
+    va_start(args, format);
+    vsnprintf(line.text, sizeof(line.text), format, args);
+    va_end(args);
+
+    if (!s_queue) {
+        Serial.print(line.text);
+        return;
+    }
+    if (xQueueSend(s_queue, &line, 0) != pdTRUE) {
+        s_dropped++;
+    }
+}
@@ -0,0 +1,24 @@
+/**
+ * FighterLink Status Log
+ *
+ * Runtime status lines are formatted into a queue and written to Serial by
+ * a low-priority task, so a slow or absent serial host (USB CDC writes wait
+ * out a TX timeout once its buffer fills) can never stall acquisition or a
+ * notify(). When the queue is full the line is dropped and counted; the
+ * next line written reports how many went missing.
+ *
+ * Boot code in setup() keeps printing directly: nothing is streaming yet.
+ */
+
+#ifndef STATUS_LOG_H
+#define STATUS_LOG_H
+
+#include <stdint.h>
+
+// Create the queue and start the writer task
+void statusLogBegin();
+
+// printf-style; never blocks. Falls back to Serial before statusLogBegin().
+void statusLog(const char* format, ...) __attribute__((format(printf, 1, 2)));
+
+#endif // STATUS_LOG_H
@@ -0,0 +1,97 @@
+/**
+ * FighterLink Stillness Detection
+ *
+ * Limits and window length mirror server/analytics/analyzer.go so the glove
+ * and the server take their gravity reference from the same stretch.
+ */
+
+#include "stillness.h"
+
+// ─── StillnessWindow ─────────────────────────────────────────────────────────
+StillnessWindow::StillnessWindow(float accelThresh, float gyroThresh) {
+    const int64_t n2 = (int64_t)STILLNESS_SAMPLES * STILLNESS_SAMPLES;
+    _accelLimit = (int64_t)(accelThresh * ACCEL_SCALE * accelThresh * ACCEL_SCALE) * n2;
+    _gyroLimit = (int64_t)(gyroThresh * GYRO_SCALE * gyroThresh * GYRO_SCALE) * n2;
+    clear();
+}
+
+void StillnessWindow::add(const SampleRecord& sample) {
+    const int16_t axes[6] = {sample.accX, sample.accY, sample.accZ,
+                             sample.gyroX, sample.gyroY, sample.gyroZ};
+    int16_t* slot = _samples[_next];
+    for (int axis = 0; axis < 6; axis++) {
+        if (full()) {
+            _sum[axis] -= slot[axis];
+            _sumSq[axis] -= (int32_t)slot[axis] * slot[axis];
+        }
+        slot[axis] = axes[axis];
+        _sum[axis] += axes[axis];
+        _sumSq[axis] += (int32_t)axes[axis] * axes[axis];
+    }
+
+    _next = (_next + 1) % STILLNESS_SAMPLES;
+    if (!full()) {
+        _count++;
+    }
+}
+
+bool StillnessWindow::still() const {
+    if (!full()) return false;
+
+    const int64_t n = _count;
+    int64_t accel = 0;
+    int64_t gyro = 0;
+    for (int axis = 0; axis < 3; axis++) {
+        accel += n * _sumSq[axis] - _sum[axis] * _sum[axis];
+        gyro += n * _sumSq[axis + 3] - _sum[axis + 3] * _sum[axis + 3];
+    }
+    return accel < _accelLimit && gyro < _gyroLimit;
+}
+
+void StillnessWindow::clear() {
+    for (int axis = 0; axis < 6; axis++) {
+        _sum[axis] = 0;
+        _sumSq[axis] = 0;
+    }
+    _next = 0;
+    _count = 0;
+}
+
+// ─── GravityCapture ──────────────────────────────────────────────────────────
+bool GravityCapture::update(const SampleRecord& sample, uint32_t timestamp) {
+    _window.add(sample);
+    if (_done) return false;
+
+    if (!_window.still()) {
+        // Movement: start over
+        _still = false;
+        _progress = 0.0f;
+        return false;
+    }
+    if (!_still) {
+        _still = true;
+        _stillSince = timestamp;
+    }
+
+    // Sample time, so the rule doesn't depend on the sample rate
+    uint32_t stillUs = timestamp - _stillSince;
+    _progress = stillUs >= STILLNESS_WINDOW_MS * 1000UL ? 1.0f
+                                                        : stillUs / (STILLNESS_WINDOW_MS * 1000.0f);
+    if (stillUs < STILLNESS_WINDOW_MS * 1000UL) return false;
+
+    for (int axis = 0; axis < 3; axis++) {
+        _gravity[axis] = _window.mean(axis) / ACCEL_SCALE;
+    }
+    _done = true;
+    return true;
+}
+
+void GravityCapture::reset() {
+    _window.clear();
+    _still = false;
+    _done = false;
+    _progress = 0.0f;
+    _gravity[0] = 0.0f;
+    _gravity[1] = 0.0f;
+    _gravity[2] = GRAVITY_MS2;
+}
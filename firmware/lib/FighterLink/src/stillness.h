@@ -0,0 +1,79 @@
+/**
+ * FighterLink Stillness Detection
+ *
+ * Sliding-window variance over the last STILLNESS_SAMPLES samples in packet
+ * units, so the running sums are exact integers that never drift. Port of
+ * the server Analyzer's stillnessWindow (and of the Arduino sketch's
+ * checkStillness), with its combined-variance rule: the accel and gyro
+ * variances, each summed over the three axes, must both stay below their
+ * thresholds. n²·var = n·Σx² − (Σx)², so adding a sample and testing are
+ * O(1) with no division.
+ *
+ * GravityCapture runs the Analyzer's calibration phase on top: once the
+ * window has stayed still for STILLNESS_WINDOW_MS of sample time, its mean
+ * acceleration is the gravity reference. Hardware-independent.
+ */
+
+#ifndef STILLNESS_H
+#define STILLNESS_H
+
+#include <stdint.h>
+
+#include "config.h"
+#include "sensor_packet.h"
+
+class StillnessWindow {
+public:
+    // Thresholds in m/s² and °/s (STILLNESS_ACCEL_THRESH / _GYRO_THRESH)
+    StillnessWindow(float accelThresh = STILLNESS_ACCEL_THRESH,
+                    float gyroThresh = STILLNESS_GYRO_THRESH);
+
+    // Push a sample, evicting the oldest once the window is full
+    void add(const SampleRecord& sample);
+
+    bool full() const { return _count == STILLNESS_SAMPLES; }
+
+    // Window full and both combined variances below their limits
+    bool still() const;
+
+    // Window mean of one axis (accX..gyroZ order), packet units
+    float mean(int axis) const { return _count ? (float)_sum[axis] / _count : 0.0f; }
+
+    void clear();
+
+private:
+    int16_t _samples[STILLNESS_SAMPLES][6];
+    int64_t _sum[6];
+    int64_t _sumSq[6];
+    uint16_t _next = 0;
+    uint16_t _count = 0;
+    int64_t _accelLimit;    // n²-scaled, packet units²
+    int64_t _gyroLimit;
+};
+
+class GravityCapture {
+public:
+    // Feed one sample (packet units, µs timestamp). Returns true once, on the
+    // sample that completes the still stretch; gravity() is valid from then.
+    bool update(const SampleRecord& sample, uint32_t timestamp);
+
+    bool done() const { return _done; }
+
+    // m/s², sensor frame
+    const float* gravity() const { return _gravity; }
+
+    // Calibration progress, 0..1 of STILLNESS_WINDOW_MS
+    float progress() const { return _progress; }
+
+    void reset();
+
+private:
+    StillnessWindow _window;
+    bool _still = false;
+    bool _done = false;
+    uint32_t _stillSince = 0;
+    float _progress = 0.0f;
+    float _gravity[3] = {0.0f, 0.0f, GRAVITY_MS2};
+};
+
+#endif // STILLNESS_H
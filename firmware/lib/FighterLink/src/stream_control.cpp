@@ -0,0 +1,94 @@
+/**
+ * FighterLink Stream Control
+ */
+
+#include <string.h>
+
+#include "stream_control.h"
+
+// Profiles above 100Hz need the FIFO to capture and batching to send
+#define HIGH_RATES_SUPPORTED    (BATCH_ENABLED && IMU_FIFO_ENABLED)
+
+// Fused records only travel in batched frames
+#define FUSED_SUPPORTED         (BATCH_ENABLED && FUSION_ENABLED)
+
+StreamConfig defaultStreamConfig() {
+    const RateProfile& profile = rateProfile(RATE_PROFILE);
+
+    StreamConfig config;
+    config.version = STREAM_CONFIG_VERSION;
+    config.profile = RATE_PROFILE;
+    config.mode = STREAM_MODE;
+    config.encoding = BATCH_ENCODING;
+    config.accelRange = profile.accelRange;
+    config.gyroRange = profile.gyroRange;
+    config.format = FRAME_FORMAT_PACKET;
+    return config;
+}
+
+bool parseControlWrite(const uint8_t* data, size_t length, StreamConfig& config) {
+    StreamConfig next = config;
+    next.format = FRAME_FORMAT_PACKET;
+    size_t i = 0;
+
+    while (i < length) {
+        uint8_t op = data[i++];
+        size_t args = op == CONTROL_OP_RANGES ? 2 : 1;
+        if (i + args > length) return false;
+        const uint8_t* arg = data + i;
+        i += args;
+
+        switch (op) {
+        case CONTROL_OP_PROFILE:
+            if (arg[0] >= RATE_PROFILE_COUNT) return false;
+            if (!HIGH_RATES_SUPPORTED && arg[0] != RATE_PROFILE_100HZ) return false;
+            next.profile = arg[0];
+            next.accelRange = rateProfile(arg[0]).accelRange;
+            next.gyroRange = rateProfile(arg[0]).gyroRange;
+            break;
+        case CONTROL_OP_MODE:
+            if (arg[0] > STREAM_MODE_FUSED) return false;
+            if (!FUSED_SUPPORTED && arg[0] == STREAM_MODE_FUSED) return false;
+            next.mode = arg[0];
+            break;
+        case CONTROL_OP_ENCODING:
+            if (arg[0] > ENCODING_DELTA) return false;
+            next.encoding = arg[0];
+            break;
+        case CONTROL_OP_RANGES:
+            if (arg[0] >= SENSOR_RANGE_COUNT || arg[1] >= SENSOR_RANGE_COUNT) return false;
+            next.accelRange = arg[0];
+            next.gyroRange = arg[1];
+            break;
+        case CONTROL_OP_FORMAT:
+            if (arg[0] > FRAME_FORMAT_LSB) return false;
+            if (!BATCH_ENABLED && arg[0] == FRAME_FORMAT_LSB) return false;
+            next.format = arg[0];
+            break;
+        default:
+            return false;
+        }
+    }
+
+    config = next;
+    return true;
+}
+
+bool parseResendWrite(const uint8_t* data, size_t length, ResendRequest& request) {
+    if (length != RESEND_REQUEST_SIZE || data[0] != CONTROL_OP_RESEND) return false;
+
+    ResendRequest next;
+    memcpy(&next.sequence, data + 1, sizeof(next.sequence));
+    memcpy(&next.count, data + 5, sizeof(next.count));
+    if (next.count == 0) return false;
+
+    request = next;
+    return true;
+}
+
+bool parseLatencyWrite(const uint8_t* data, size_t length, uint8_t& every) {
+    if (length != LATENCY_REQUEST_SIZE || data[0] != CONTROL_OP_LATENCY) return false;
+
+    every = data[1];
+    return true;
+}
@@ -0,0 +1,115 @@
+/**
+ * FighterLink Stream Control
+ *
+ * Wire format of the writable control characteristic, which lets the
+ * central change rate, mode, encoding and ranges without a reflash. A write
+ * is a sequence of commands, each an opcode followed by fixed-size
+ * arguments, applied together or not at all:
+ *
+ * Command   | Bytes                               | Notes
+ * ----------|-------------------------------------|----------------------------
+ * PROFILE   | 0x01, RATE_PROFILE_*                | also selects its ranges
+ * MODE      | 0x02, STREAM_MODE_*                 |
+ * ENCODING  | 0x03, ENCODING_*                    | raised to the profile minimum
+ * RANGES    | 0x04, ACCEL_RANGE_*, GYRO_RANGE_*   | after PROFILE to override it
+ * FORMAT    | 0x06, FRAME_FORMAT_*                | batched frames only
+ *
+ * FORMAT holds for the write it comes in: a write without it streams packet
+ * units, so centrals that predate it keep getting frames they can parse.
+ *
+ * Reading the characteristic returns the active StreamConfig; it is also
+ * notified each time a new configuration takes effect. The configuration
+ * reverts to the config.h defaults when the central disconnects.
+ *
+ * A resend request (NACK) is a write of its own and leaves the configuration
+ * alone. The frames still in the resend buffer that hold any of the samples
+ * go out again on the bulk characteristic:
+ *
+ * Command   | Bytes                                   | Notes
+ * ----------|-----------------------------------------|------------------------
+ * RESEND    | 0x05, sequence (uint32), count (uint16) | little-endian
+ *
+ * A latency write is also a write of its own. It makes every Nth sensor
+ * frame carry a LatencyTraceFrame behind it (sensor_packet.h) until the
+ * central disconnects:
+ *
+ * Command   | Bytes                                   | Notes
+ * ----------|-----------------------------------------|------------------------
+ * LATENCY   | 0x07, every (uint8)                     | frames; 0 stops tracing
+ */
+
+#ifndef STREAM_CONTROL_H
+#define STREAM_CONTROL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "rate_profile.h"
+
+#define CONTROL_OP_PROFILE      0x01
+#define CONTROL_OP_MODE         0x02
+#define CONTROL_OP_ENCODING     0x03
+#define CONTROL_OP_RANGES       0x04
+#define CONTROL_OP_RESEND       0x05
+#define CONTROL_OP_FORMAT       0x06
+#define CONTROL_OP_LATENCY      0x07
+
+#define RESEND_REQUEST_SIZE     7       // Opcode + sequence + count
+#define LATENCY_REQUEST_SIZE    2       // Opcode + every
+
+#define STREAM_CONFIG_VERSION   2
+
+// Sample units of batched frames
+#define FRAME_FORMAT_PACKET     0       // m/s² × ACCEL_SCALE, °/s × GYRO_SCALE (v1)
+#define FRAME_FORMAT_LSB        1       // Sensor LSB behind a FrameHeaderV2 (sensor_packet.h)
+
+/**
+ * Active stream configuration (7 bytes, characteristic value)
+ *
+ * Field      | Offset | Size | Type  | Notes
+ * -----------|--------|------|-------|---------------------------
+ * version    | 0      | 1    | uint8 | STREAM_CONFIG_VERSION
+ * profile    | 1      | 1    | uint8 | RATE_PROFILE_*
+ * mode       | 2      | 1    | uint8 | STREAM_MODE_*
+ * encoding   | 3      | 1    | uint8 | ENCODING_* requested
+ * accelRange | 4      | 1    | uint8 | ACCEL_RANGE_*
+ * gyroRange  | 5      | 1    | uint8 | GYRO_RANGE_*
+ * format     | 6      | 1    | uint8 | FRAME_FORMAT_*
+ */
+struct __attribute__((packed)) StreamConfig {
+    uint8_t version;
+    uint8_t profile;
+    uint8_t mode;
+    uint8_t encoding;
+    uint8_t accelRange;
+    uint8_t gyroRange;
+    uint8_t format;
+};
+
+static_assert(sizeof(StreamConfig) == 7, "StreamConfig must be exactly 7 bytes");
+
+// RATE_PROFILE, STREAM_MODE and BATCH_ENCODING from config.h
+StreamConfig defaultStreamConfig();
+
+/**
+ * Apply a control write on top of config. Returns false, leaving config
+ * untouched, if any command is unknown, truncated or out of range, or asks
+ * for a rate or mode this build cannot carry.
+ */
+bool parseControlWrite(const uint8_t* data, size_t length, StreamConfig& config);
+
+// Samples [sequence, sequence + count) the central did not receive
+struct ResendRequest {
+    uint32_t sequence;
+    uint16_t count;
+};
+
+// Decode a resend request write. False if the write is anything else.
+bool parseResendWrite(const uint8_t* data, size_t length, ResendRequest& request);
+
+// Decode a latency trace request: trace every Nth sensor frame, 0 for
+// none. False if the write is anything else.
+bool parseLatencyWrite(const uint8_t* data, size_t length, uint8_t& every);
+
+#endif // STREAM_CONTROL_H
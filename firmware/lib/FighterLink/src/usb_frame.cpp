@@ -0,0 +1,82 @@
+/**
+ * FighterLink USB Framing
+ */
+
+#include <string.h>
+
+#include "usb_frame.h"
+
+uint16_t usbFrameCrc(const uint8_t* data, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = crc & 0x8000 ? (uint16_t)(crc << 1) ^ 0x1021 : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+size_t usbFrameEncode(uint8_t hand, const uint8_t* frame, size_t length, uint8_t* out) {
+    if (length > USB_FRAME_MAX_PAYLOAD) return 0;
+
+    out[0] = USB_FRAME_SYNC0;
+    out[1] = USB_FRAME_SYNC1;
+    out[2] = hand;
+    out[3] = (uint8_t)length;
+    out[4] = (uint8_t)(length >> 8);
+    memcpy(out + sizeof(UsbFrameHeader), frame, length);
+
+    // Sync bytes excluded: they are what a reader already matched
+    size_t end = sizeof(UsbFrameHeader) + length;
+    uint16_t crc = usbFrameCrc(out + 2, end - 2);
+    out[end] = (uint8_t)crc;
+    out[end + 1] = (uint8_t)(crc >> 8);
+    return end + USB_FRAME_CRC_BYTES;
+}
+
+bool UsbFrameReader::feed(uint8_t byte) {
+    if (_frameBytes > 0) {
+        skip(_frameBytes);
+        _frameBytes = 0;
+    }
+    if (_pos == 0 && byte != USB_FRAME_SYNC0) return false;    // Status text
+    _buf[_pos++] = byte;
+
+    // _buf[0] is always a sync candidate; a bad frame drops only that byte,
+    // so a real sync among the bytes already taken is still found
+    while (_pos > 1) {
+        if (_buf[1] != USB_FRAME_SYNC1) {
+            skip(1);
+            continue;
+        }
+        if (_pos < sizeof(UsbFrameHeader)) return false;
+
+        size_t length = _buf[3] | (size_t)_buf[4] << 8;
+        if (length > USB_FRAME_MAX_PAYLOAD) {
+            _rejected++;
+            skip(1);
+            continue;
+        }
+        size_t end = sizeof(UsbFrameHeader) + length;
+        if (_pos < end + USB_FRAME_CRC_BYTES) return false;
+
+        uint16_t crc = _buf[end] | (uint16_t)_buf[end + 1] << 8;
+        if (usbFrameCrc(_buf + 2, end - 2) != crc) {
+            _rejected++;
+            skip(1);
+            continue;
+        }
+        _length = length;
+        _frameBytes = end + USB_FRAME_CRC_BYTES;
+        return true;
+    }
+    return false;
+}
+
+void UsbFrameReader::skip(size_t count) {
+    const uint8_t* sync = (const uint8_t*)memchr(_buf + count, USB_FRAME_SYNC0, _pos - count);
+    size_t from = sync ? (size_t)(sync - _buf) : _pos;
+    memmove(_buf, _buf + from, _pos - from);
+    _pos -= from;
+}
@@ -0,0 +1,55 @@
+/**
+ * FighterLink USB Framing
+ *
+ * Byte-stream framing for the USB transport (USB_TRANSPORT_ENABLED): a
+ * UsbFrameHeader (sensor_packet.h), the frame as the sensor characteristic
+ * would have notified it, then a CRC-16 so a glitch or a status line cut
+ * into a frame loses that frame only. The same framing carries control
+ * writes from the host. Hardware-independent; the caller does the I/O.
+ */
+
+#ifndef USB_FRAME_H
+#define USB_FRAME_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sample_batcher.h"
+#include "sensor_packet.h"
+
+#define USB_FRAME_MAX_PAYLOAD   BATCH_MAX_PAYLOAD
+#define USB_FRAME_CRC_BYTES     2
+#define USB_FRAME_MAX_BYTES     (sizeof(UsbFrameHeader) + USB_FRAME_MAX_PAYLOAD + USB_FRAME_CRC_BYTES)
+
+// CRC-16/CCITT-FALSE (polynomial 0x1021, initial 0xFFFF, no reflection)
+uint16_t usbFrameCrc(const uint8_t* data, size_t length);
+
+// Frame length bytes of frame for hand into out (USB_FRAME_MAX_BYTES).
+// Returns the bytes to write, 0 if frame is over USB_FRAME_MAX_PAYLOAD.
+size_t usbFrameEncode(uint8_t hand, const uint8_t* frame, size_t length, uint8_t* out);
+
+// Picks frames out of a byte stream, skipping whatever lies between them
+class UsbFrameReader {
+public:
+    // Take the next byte. Returns true when it completes a frame with a
+    // good CRC; data()/length() then hold it until the next feed().
+    bool feed(uint8_t byte);
+
+    const uint8_t* data() const { return _buf + sizeof(UsbFrameHeader); }
+    size_t length() const { return _length; }
+
+    // Frames dropped for a bad length or CRC
+    uint32_t rejected() const { return _rejected; }
+
+private:
+    // Drop count bytes, then any up to the next sync candidate
+    void skip(size_t count);
+
+    uint8_t _buf[USB_FRAME_MAX_BYTES];
+    size_t _pos = 0;
+    size_t _length = 0;
+    size_t _frameBytes = 0;     // Frame returned last feed(), still at _buf[0]
+    uint32_t _rejected = 0;
+};
+
+#endif // USB_FRAME_H
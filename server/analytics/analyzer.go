@@ -15,6 +15,7 @@ const (
 	// Punch detection thresholds
 	punchThreshold = 25.0 // m/s² - acceleration above gravity for punch detection
 	debounceMS     = 300  // milliseconds between valid punches
+	comboGapMS     = 800  // max gap between consecutive punches of a combination (either hand)
 
 	// Punch classification thresholds (gyroscope-based)
 	hookGyroThresh     = 200.0 // °/s - rotation around "up" axis for hook detection
@@ -26,9 +27,7 @@ const (
 	rollingBufSize   = 500 // 5 seconds at 100Hz
 
 	// Calibration constants
-	calibrationDuration   = 3.0 // seconds of stillness required
-	calibrationSampleRate = 100 // samples per second (100Hz)
-	calibrationSamples    = 300 // 3 seconds * 100Hz
+	calibrationDuration   = 3.0 // seconds of stillness required (sample time, any sample rate)
 	stillnessAccelThresh  = 0.5 // m/s² - max acceleration variance to be "still"
 	stillnessGyroThresh   = 5.0 // °/s - max gyro variance to be "still"
 	calibrationBufferSize = 50  // samples for variance calculation
@@ -52,8 +51,19 @@ type PunchEvent struct {
 	Type      PunchType `json:"type"`
 	Force     float64   `json:"force"`      // m/s²
 	RotationZ float64   `json:"rotation_z"` // peak °/s
-	Timestamp int64     `json:"ts"`         // device timestamp
+	Timestamp int64     `json:"ts"`         // server clock, ms since the epoch (both hands on one timeline)
 	Count     int       `json:"count"`      // punch number in session
+
+	Features *PunchFeatures `json:"features,omitempty"` // Only from gloves reporting them (event-only mode)
+}
+
+// PunchFeatures are measured on the glove over the full-rate samples
+// around one punch.
+type PunchFeatures struct {
+	Impulse      float64    `json:"impulse"`       // m/s, |linear accel| over the impact
+	DurationMs   float64    `json:"duration_ms"`   // impact duration
+	RetractionMs float64    `json:"retraction_ms"` // peak to pull-back
+	PeakGyro     [3]float64 `json:"peak_gyro"`     // signed peak °/s per sensor axis
 }
 
 // HandState holds analytics for one hand.
@@ -61,6 +71,7 @@ type HandState struct {
 	Connected      bool           `json:"connected"`
 	Calibrated     bool           `json:"calibrated"`
 	Battery        uint8          `json:"battery"`
+	Idle           bool           `json:"idle"` // Glove streaming its idle rate tier
 	PacketLoss     float64        `json:"packet_loss"`
 	PunchCount     int            `json:"punch_count"`
 	PunchBreakdown map[string]int `json:"punch_breakdown"`
@@ -71,6 +82,7 @@ type HandState struct {
 	// Current sensor values (for logging/debugging)
 	CurrentAccel [3]float64 `json:"current_accel"` // X, Y, Z in m/s²
 	CurrentGyro  [3]float64 `json:"current_gyro"`  // X, Y, Z in °/s
+	CurrentQuat  [4]float64 `json:"current_quat"`  // W, X, Y, Z, sensor → world (fused stream only)
 
 	// Calibration state
 	CalibrationProgress float64    `json:"calibration_progress"` // 0.0 to 1.0
@@ -79,17 +91,21 @@ type HandState struct {
 	UpAxis              int        `json:"up_axis"`              // 0=X, 1=Y, 2=Z - which axis points up
 
 	// Internal state
-	forceSum          float64      // sum of all punch forces
-	lastPunchTS       int64        // last punch timestamp (device)
-	lastPunchTime     time.Time    // last punch time (local)
-	calibrationBuffer [][6]float64 // rolling buffer for stillness detection [ax,ay,az,gx,gy,gz]
-	stillnessCounter  int          // consecutive "still" samples
-	serverCalibrated  bool         // true when server has captured gravity reference
+	forceSum         float64         // sum of all punch forces
+	lastPunchTS      int64           // last punch time (µs, shared timeline)
+	backfillPunchTS  int64           // last punch found in replayed samples (µs, shared timeline)
+	lastPunchTime    time.Time       // last punch time (local)
+	stillness        stillnessWindow // sliding window for stillness detection
+	stillnessCounter int             // consecutive "still" samples
+	stillSinceTS     int64           // time of the first sample in the still run (µs, shared timeline)
+	serverCalibrated bool            // true when server has captured gravity reference
 }
 
 // CombinedStats holds aggregated stats from both hands.
 type CombinedStats struct {
 	TotalPunches   int     `json:"total_punches"`
+	Combos         int     `json:"combos"`    // Runs of 2+ punches within comboGapMS, across hands
+	MaxCombo       int     `json:"max_combo"` // Longest such run
 	AvgForce       float64 `json:"avg_force"`
 	MaxForce       float64 `json:"max_force"`
 	PunchesPerMin  float64 `json:"ppm"`
@@ -105,6 +121,8 @@ type SessionState struct {
 	Right      *HandState    `json:"right"`
 	Combined   CombinedStats `json:"combined"`
 	Paused     bool          `json:"paused"` // true if a glove disconnected
+
+	Latency *PunchLatency `json:"-"` // Set on the broadcast that first carries a punch
 }
 
 // StateHandler is called when session state changes.
@@ -120,6 +138,7 @@ type Analyzer struct {
 	active    bool
 	paused    bool
 	startedAt time.Time
+	combo     comboTracker
 	onState   StateHandler
 }
 
@@ -153,6 +172,7 @@ func (a *Analyzer) StartSession() {
 
 	a.left = newHandState()
 	a.right = newHandState()
+	a.combo = comboTracker{}
 	a.active = true
 	a.paused = false
 	a.startedAt = time.Now()
@@ -167,6 +187,7 @@ func (a *Analyzer) ResetSession() {
 
 	a.left = newHandState()
 	a.right = newHandState()
+	a.combo = comboTracker{}
 	a.active = false
 	a.paused = false
 
@@ -243,6 +264,7 @@ func (a *Analyzer) ProcessPacket(hand ble.Hand, packet *ble.SensorPacket) {
 
 	// Update battery status
 	state.Battery = packet.Battery
+	state.Idle = packet.IsIdle()
 
 	// Get acceleration and gyroscope values
 	ax, ay, az := packet.AccelMS2()
@@ -251,28 +273,35 @@ func (a *Analyzer) ProcessPacket(hand ble.Hand, packet *ble.SensorPacket) {
 	// Store current sensor values (for logging/dashboard)
 	state.CurrentAccel = [3]float64{ax, ay, az}
 	state.CurrentGyro = [3]float64{gx, gy, gz}
+	if packet.Fused {
+		for i, q := range packet.Quat {
+			state.CurrentQuat[i] = float64(q) / ble.QuatScale
+		}
+	}
 
 	// ─── Calibration Phase ───────────────────────────────────────────────────
-	// Add sample to calibration buffer
-	state.calibrationBuffer = append(state.calibrationBuffer, [6]float64{ax, ay, az, gx, gy, gz})
-	if len(state.calibrationBuffer) > calibrationSamples {
-		state.calibrationBuffer = state.calibrationBuffer[1:] // Keep last N samples
-	}
+	// Add sample to the stillness window (raw packet units)
+	state.stillness.add([6]int16{packet.AccX, packet.AccY, packet.AccZ, packet.GyroX, packet.GyroY, packet.GyroZ})
 
 	// Server-side calibration: detect stillness and capture gravity reference
 	if !state.serverCalibrated {
-		if isStill(state.calibrationBuffer) {
+		if state.stillness.isStill() {
+			if state.stillnessCounter == 0 {
+				state.stillSinceTS = packet.Time
+			}
 			state.stillnessCounter++
 
-			// Update progress (0.0 to 1.0)
-			state.CalibrationProgress = float64(state.stillnessCounter) / float64(calibrationSamples)
+			// Update progress (0.0 to 1.0) from sample time, so it does not
+			// depend on the glove's sample rate
+			stillSeconds := float64(packet.Time-state.stillSinceTS) / 1e6
+			state.CalibrationProgress = stillSeconds / calibrationDuration
 			if state.CalibrationProgress > 1.0 {
 				state.CalibrationProgress = 1.0
 			}
 
-			// After 3 seconds of stillness (300 samples at 100Hz)
-			if state.stillnessCounter >= calibrationSamples {
-				state.GravityRef = captureGravityReference(state.calibrationBuffer)
+			// After 3 seconds of stillness
+			if stillSeconds >= calibrationDuration {
+				state.GravityRef = state.stillness.gravityReference()
 				state.UpAxis, state.GloveOrientation = detectOrientation(state.GravityRef)
 				state.serverCalibrated = true
 				state.Calibrated = true
@@ -303,57 +332,210 @@ func (a *Analyzer) ProcessPacket(hand ble.Hand, packet *ble.SensorPacket) {
 		return
 	}
 
-	// Calculate gravity-compensated acceleration magnitude
+	a.detectPunchLocked(state, handName, packet, &state.lastPunchTS)
+}
+
+// ProcessBackfillPacket handles a sample that arrived late: replayed from
+// the glove's disconnect log, or resent to fill a gap in the live stream.
+// Only punch detection runs, debounced separately: the samples are older
+// than the live stream, so they must not touch calibration or the current
+// sensor values.
+func (a *Analyzer) ProcessBackfillPacket(hand ble.Hand, packet *ble.SensorPacket) {
+	a.mu.Lock()
+	defer a.mu.Unlock()
+
+	state := a.left
+	handName := "left"
+	if hand == ble.RightHand {
+		state = a.right
+		handName = "right"
+	}
+
+	if !state.serverCalibrated || !a.active || a.paused {
+		return
+	}
+	// A resent sample may belong to a punch the live stream already caught
+	if d := packet.Time - state.lastPunchTS; d > -debounceMS*1000 && d < debounceMS*1000 {
+		return
+	}
+	a.detectPunchLocked(state, handName, packet, &state.backfillPunchTS)
+}
+
+// detectPunchLocked runs threshold + debounce detection on one calibrated
+// sample; lastTS is the debounce reference it advances. Must be called with
+// a.mu held.
+func (a *Analyzer) detectPunchLocked(state *HandState, handName string, packet *ble.SensorPacket, lastTS *int64) {
+	ax, ay, az := packet.AccelMS2()
+	gx, gy, gz := packet.GyroDPS()
+
+	// Calculate gravity-compensated acceleration magnitude. A fused packet
+	// carries the glove's own estimate along its current attitude; otherwise
+	// the reference captured at calibration is all there is.
 	punchAx := ax - state.GravityRef[0]
 	punchAy := ay - state.GravityRef[1]
 	punchAz := az - state.GravityRef[2]
+	upAxis := state.UpAxis
+	if packet.Fused {
+		punchAx, punchAy, punchAz = packet.LinearAccelMS2()
+		upAxis, _ = detectOrientation(packet.UpVector())
+	}
 	mag := math.Sqrt(punchAx*punchAx + punchAy*punchAy + punchAz*punchAz)
 
 	// Punch detection: threshold + debounce
-	timeSinceLast := int64(packet.Timestamp) - state.lastPunchTS
-	if mag > punchThreshold && timeSinceLast > debounceMS {
-		// Classify punch type based on gyroscope data and calibrated up axis
-		punchType := classifyPunch(gx, gy, gz, state.UpAxis)
-
-		// Update stats
-		state.PunchCount++
-		state.lastPunchTS = int64(packet.Timestamp)
-		state.lastPunchTime = time.Now()
-
-		if mag > state.MaxForce {
-			state.MaxForce = mag
-		}
+	timeSinceLast := packet.Time - *lastTS
+	if mag > punchThreshold && timeSinceLast > debounceMS*1000 {
+		// Classify punch type based on gyroscope data and the up axis
+		punchType := classifyPunch(gx, gy, gz, upAxis)
 
-		state.forceSum += mag
-		state.AvgForce = state.forceSum / float64(state.PunchCount)
+		*lastTS = packet.Time
+		a.recordPunchLocked(state, handName, punchType, mag, math.Abs(gz), packet.Time, packet.Received, nil)
+	}
+}
 
-		// Calculate punches per minute
-		elapsed := time.Since(a.startedAt).Minutes()
-		if elapsed > 0 {
-			state.PunchesPerMin = float64(state.PunchCount) / elapsed
-		}
+// ProcessPunchRecord handles a punch (or heartbeat) detected on the glove
+// in event-only streaming mode. No raw samples arrive in that mode, so
+// calibration state comes from the glove's own flag.
+func (a *Analyzer) ProcessPunchRecord(hand ble.Hand, record *ble.PunchRecord) {
+	a.mu.Lock()
+	defer a.mu.Unlock()
 
-		// Update punch breakdown
-		state.PunchBreakdown[string(punchType)]++
-
-		// Create punch event
-		event := PunchEvent{
-			Hand:      handName,
-			Type:      punchType,
-			Force:     math.Round(mag*100) / 100,
-			RotationZ: math.Abs(gz),
-			Timestamp: int64(packet.Timestamp),
-			Count:     state.PunchCount,
+	state := a.left
+	handName := "left"
+	if hand == ble.RightHand {
+		state = a.right
+		handName = "right"
+	}
+
+	state.Battery = record.Battery
+	state.Idle = record.IsIdle()
+
+	calibrated := record.IsCalibrated()
+	if calibrated != state.Calibrated {
+		state.Calibrated = calibrated
+		if calibrated {
+			state.CalibrationProgress = 1.0
+		} else {
+			state.CalibrationProgress = 0
 		}
+		a.broadcastLocked()
+	}
+
+	if record.IsHeartbeat() || !a.active || a.paused {
+		return
+	}
 
-		// Add to recent punches (limited buffer)
-		state.RecentPunches = append(state.RecentPunches, event)
-		if len(state.RecentPunches) > maxRecentPunches {
-			state.RecentPunches = state.RecentPunches[1:]
+	var features *PunchFeatures
+	if f := record.Features; f != nil {
+		features = &PunchFeatures{
+			Impulse:      f.ImpulseMS(),
+			DurationMs:   f.DurationMs(),
+			RetractionMs: f.RetractionMs(),
+			PeakGyro:     f.PeakGyroDPS(),
 		}
+	}
+	a.recordPunchLocked(state, handName, punchTypeFromRecord(record.Type),
+		record.ForceMS2(), record.RotationDPS(), record.Time, record.Received, features)
+}
 
-		// Broadcast state update
-		a.broadcastLocked()
+// punchTypeFromRecord maps on-glove punch type codes to PunchType.
+func punchTypeFromRecord(t uint8) PunchType {
+	switch t {
+	case ble.PunchTypeStraight:
+		return PunchStraight
+	case ble.PunchTypeHook:
+		return PunchHook
+	case ble.PunchTypeUppercut:
+		return PunchUppercut
+	default:
+		return PunchUnknown
+	}
+}
+
+// recordPunchLocked updates hand stats for one detected punch at ts (µs,
+// shared timeline) whose frame arrived at received (0 for replayed samples)
+// and broadcasts. Must be called with a.mu held.
+func (a *Analyzer) recordPunchLocked(state *HandState, handName string, punchType PunchType, force, rotation float64, ts, received int64, features *PunchFeatures) {
+	// Update stats
+	state.PunchCount++
+	state.lastPunchTime = time.Now()
+	a.combo.add(ts)
+
+	if force > state.MaxForce {
+		state.MaxForce = force
+	}
+
+	state.forceSum += force
+	state.AvgForce = state.forceSum / float64(state.PunchCount)
+
+	// Calculate punches per minute
+	elapsed := time.Since(a.startedAt).Minutes()
+	if elapsed > 0 {
+		state.PunchesPerMin = float64(state.PunchCount) / elapsed
+	}
+
+	// Update punch breakdown
+	state.PunchBreakdown[string(punchType)]++
+
+	// Create punch event
+	event := PunchEvent{
+		Hand:      handName,
+		Type:      punchType,
+		Force:     math.Round(force*100) / 100,
+		RotationZ: rotation,
+		Timestamp: ts / 1000,
+		Count:     state.PunchCount,
+		Features:  features,
+	}
+
+	// Add to recent punches (limited buffer)
+	state.RecentPunches = append(state.RecentPunches, event)
+	if len(state.RecentPunches) > maxRecentPunches {
+		state.RecentPunches = state.RecentPunches[1:]
+	}
+
+	// Broadcast state update, stamped for latency tracing unless the punch
+	// was in replayed samples
+	var latency *PunchLatency
+	if received != 0 {
+		latency = &PunchLatency{Captured: ts, Received: received, Detected: time.Now().UnixMicro()}
+	}
+	a.broadcastPunchLocked(latency)
+}
+
+// comboTracker chains punches from either hand that follow each other within
+// comboGapMS. It relies on both gloves' timestamps sharing the server clock.
+type comboTracker struct {
+	lastTS  int64 // µs, newest punch of the current run
+	length  int   // punches in the current run
+	combos  int   // runs that reached two punches
+	longest int
+}
+
+func (t *comboTracker) add(ts int64) {
+	// Punches replayed from a glove's disconnect log predate the current
+	// run; they neither extend nor break it
+	if t.length > 0 && ts < t.lastTS-comboGapMS*1000 {
+		return
+	}
+
+	// The other hand's notification may arrive after a later punch
+	gap := ts - t.lastTS
+	if gap < 0 {
+		gap = -gap
+	}
+	if t.length > 0 && gap <= comboGapMS*1000 {
+		t.length++
+		if t.length == 2 {
+			t.combos++
+		}
+	} else {
+		t.length = 1
+	}
+	if ts > t.lastTS {
+		t.lastTS = ts
+	}
+	if t.length >= 2 && t.length > t.longest {
+		t.longest = t.length
 	}
 }
 
@@ -410,74 +592,71 @@ func classifyPunch(gx, gy, gz float64, upAxis int) PunchType {
 
 // ─── Calibration Functions ───────────────────────────────────────────────────
 
-// isStill checks if the recent samples indicate the glove is stationary
-func isStill(buffer [][6]float64) bool {
-	if len(buffer) < calibrationBufferSize {
+// stillnessWindow holds the last calibrationBufferSize samples with running
+// per-axis sums, so adding a sample and testing stillness are both O(1).
+// Samples stay in packet units (m/s² × AccelScale, °/s × GyroScale), which
+// keeps the sums exact integers that never drift.
+type stillnessWindow struct {
+	samples [calibrationBufferSize][6]int16 // [ax,ay,az,gx,gy,gz]
+	next    int
+	count   int
+	sum     [6]int64
+	sumSq   [6]int64
+}
+
+// Combined-variance limits in packet units², scaled by n² (see isStill).
+const (
+	stillAccelLimit = stillnessAccelThresh * stillnessAccelThresh * ble.AccelScale * ble.AccelScale *
+		calibrationBufferSize * calibrationBufferSize
+	stillGyroLimit = stillnessGyroThresh * stillnessGyroThresh * ble.GyroScale * ble.GyroScale *
+		calibrationBufferSize * calibrationBufferSize
+)
+
+// add pushes a sample, evicting the oldest once the window is full.
+func (w *stillnessWindow) add(s [6]int16) {
+	if w.count == calibrationBufferSize {
+		for i, v := range w.samples[w.next] {
+			w.sum[i] -= int64(v)
+			w.sumSq[i] -= int64(v) * int64(v)
+		}
+	} else {
+		w.count++
+	}
+
+	w.samples[w.next] = s
+	for i, v := range s {
+		w.sum[i] += int64(v)
+		w.sumSq[i] += int64(v) * int64(v)
+	}
+	w.next = (w.next + 1) % calibrationBufferSize
+}
+
+// isStill reports whether the window is full and the combined accel and gyro
+// variances are below their thresholds. n²·var = n·Σx² − (Σx)² per axis, so
+// the comparison needs no division or square root.
+func (w *stillnessWindow) isStill() bool {
+	if w.count < calibrationBufferSize {
 		return false
 	}
 
-	// Use last N samples for variance calculation
-	samples := buffer[len(buffer)-calibrationBufferSize:]
-
-	// Calculate mean for each axis
-	var meanAx, meanAy, meanAz, meanGx, meanGy, meanGz float64
-	for _, s := range samples {
-		meanAx += s[0]
-		meanAy += s[1]
-		meanAz += s[2]
-		meanGx += s[3]
-		meanGy += s[4]
-		meanGz += s[5]
-	}
-	n := float64(len(samples))
-	meanAx /= n
-	meanAy /= n
-	meanAz /= n
-	meanGx /= n
-	meanGy /= n
-	meanGz /= n
-
-	// Calculate variance
-	var varAx, varAy, varAz, varGx, varGy, varGz float64
-	for _, s := range samples {
-		varAx += (s[0] - meanAx) * (s[0] - meanAx)
-		varAy += (s[1] - meanAy) * (s[1] - meanAy)
-		varAz += (s[2] - meanAz) * (s[2] - meanAz)
-		varGx += (s[3] - meanGx) * (s[3] - meanGx)
-		varGy += (s[4] - meanGy) * (s[4] - meanGy)
-		varGz += (s[5] - meanGz) * (s[5] - meanGz)
-	}
-	varAx /= n
-	varAy /= n
-	varAz /= n
-	varGx /= n
-	varGy /= n
-	varGz /= n
-
-	// Check if variance is below threshold
-	accelVar := math.Sqrt(varAx + varAy + varAz)
-	gyroVar := math.Sqrt(varGx + varGy + varGz)
-
-	return accelVar < stillnessAccelThresh && gyroVar < stillnessGyroThresh
-}
-
-// captureGravityReference averages recent accelerometer readings to get gravity vector
-func captureGravityReference(buffer [][6]float64) [3]float64 {
-	if len(buffer) < calibrationBufferSize {
-		return [3]float64{0, 0, 9.81} // default: Z-down
+	n := int64(w.count)
+	var accel, gyro int64
+	for i := 0; i < 3; i++ {
+		accel += n*w.sumSq[i] - w.sum[i]*w.sum[i]
+		gyro += n*w.sumSq[i+3] - w.sum[i+3]*w.sum[i+3]
 	}
 
-	samples := buffer[len(buffer)-calibrationBufferSize:]
+	return accel < int64(stillAccelLimit) && gyro < int64(stillGyroLimit)
+}
 
-	var sumAx, sumAy, sumAz float64
-	for _, s := range samples {
-		sumAx += s[0]
-		sumAy += s[1]
-		sumAz += s[2]
+// gravityReference averages the windowed accelerometer readings (m/s²).
+func (w *stillnessWindow) gravityReference() [3]float64 {
+	if w.count < calibrationBufferSize {
+		return [3]float64{0, 0, 9.81} // default: Z-down
 	}
-	n := float64(len(samples))
 
-	return [3]float64{sumAx / n, sumAy / n, sumAz / n}
+	n := float64(w.count) * ble.AccelScale
+	return [3]float64{float64(w.sum[0]) / n, float64(w.sum[1]) / n, float64(w.sum[2]) / n}
 }
 
 // detectOrientation determines which axis points "up" based on gravity reference
@@ -542,6 +721,8 @@ func (a *Analyzer) buildStateLocked() *SessionState {
 	// Build combined stats
 	combined := CombinedStats{
 		TotalPunches: a.left.PunchCount + a.right.PunchCount,
+		Combos:       a.combo.combos,
+		MaxCombo:     a.combo.longest,
 	}
 
 	if combined.TotalPunches > 0 {
@@ -586,6 +767,7 @@ func (a *Analyzer) copyHandState(h *HandState) *HandState {
 		Connected:           h.Connected,
 		Calibrated:          h.Calibrated,
 		Battery:             h.Battery,
+		Idle:                h.Idle,
 		PacketLoss:          h.PacketLoss,
 		PunchCount:          h.PunchCount,
 		PunchBreakdown:      breakdown,
@@ -595,6 +777,7 @@ func (a *Analyzer) copyHandState(h *HandState) *HandState {
 		RecentPunches:       punches,
 		CurrentAccel:        h.CurrentAccel,
 		CurrentGyro:         h.CurrentGyro,
+		CurrentQuat:         h.CurrentQuat,
 		CalibrationProgress: h.CalibrationProgress,
 		GravityRef:          h.GravityRef,
 		GloveOrientation:    h.GloveOrientation,
@@ -605,8 +788,15 @@ func (a *Analyzer) copyHandState(h *HandState) *HandState {
 // broadcastLocked sends state to the handler.
 // Must be called with a.mu held.
 func (a *Analyzer) broadcastLocked() {
+	a.broadcastPunchLocked(nil)
+}
+
+// broadcastPunchLocked sends state carrying a just-recorded punch's latency
+// stamps (nil for none) to the handler. Must be called with a.mu held.
+func (a *Analyzer) broadcastPunchLocked(latency *PunchLatency) {
 	if a.onState != nil {
 		state := a.buildStateLocked()
+		state.Latency = latency
 		// Call handler outside of lock to prevent deadlocks
 		go a.onState(state)
 	}
@@ -629,7 +819,7 @@ func (a *Analyzer) ResetCalibration(hand ble.Hand) {
 	state.Calibrated = false
 	state.CalibrationProgress = 0
 	state.stillnessCounter = 0
-	state.calibrationBuffer = nil
+	state.stillness = stillnessWindow{}
 	state.GravityRef = [3]float64{0, 0, 0}
 	state.GloveOrientation = ""
 	state.UpAxis = 0
@@ -0,0 +1,123 @@
+package analytics
+
+import (
+	"math"
+	"sort"
+	"sync"
+
+	"boxing-analytics/ble"
+)
+
+// ─── Latency ─────────────────────────────────────────────────────────────────
+
+// Stages of the path from impact to dashboard. The first two come from the
+// gloves' latency traces, the rest from punches as they are detected and
+// broadcast; end_to_end is capture to WebSocket send for those punches.
+const (
+	StageGlove     = "glove"      // Sample captured → frame handed to the glove's stack
+	StageLink      = "link"       // Handed to the stack → notification received
+	StageAnalysis  = "analysis"   // Received → punch recorded by the Analyzer
+	StageDashboard = "dashboard"  // Recorded → state written to the first WebSocket client
+	StageEndToEnd  = "end_to_end" // Captured → sent
+)
+
+// latencyWindow is how many recent measurements each stage keeps.
+const latencyWindow = 512
+
+// PunchLatency stamps one punch on its way through the server (µs, server
+// clock). The Analyzer attaches it to the state broadcast that first
+// carries the punch.
+type PunchLatency struct {
+	Captured int64 // Punch sample (or on-glove crossing) captured
+	Received int64 // Its frame arrived
+	Detected int64 // Analyzer recorded the punch
+}
+
+// LatencyStats summarizes one stage over its recent measurements.
+type LatencyStats struct {
+	Count int     `json:"count"`
+	P50Ms float64 `json:"p50_ms"`
+	P90Ms float64 `json:"p90_ms"`
+	P99Ms float64 `json:"p99_ms"`
+	MaxMs float64 `json:"max_ms"`
+}
+
+// LatencyTracker keeps the latest measurements of every stage, both hands
+// pooled, for percentile reporting.
+type LatencyTracker struct {
+	mu     sync.Mutex
+	stages map[string]*latencyRing
+}
+
+type latencyRing struct {
+	us   [latencyWindow]int64
+	next int
+	n    int
+}
+
+func (r *latencyRing) add(us int64) {
+	r.us[r.next] = us
+	r.next = (r.next + 1) % latencyWindow
+	if r.n < latencyWindow {
+		r.n++
+	}
+}
+
+// NewLatencyTracker creates an empty tracker.
+func NewLatencyTracker() *LatencyTracker {
+	return &LatencyTracker{stages: make(map[string]*latencyRing)}
+}
+
+func (t *LatencyTracker) addLocked(stage string, us int64) {
+	ring := t.stages[stage]
+	if ring == nil {
+		ring = &latencyRing{}
+		t.stages[stage] = ring
+	}
+	ring.add(us)
+}
+
+// ObserveTrace records the on-glove and link stages of a traced frame.
+func (t *LatencyTracker) ObserveTrace(trace *ble.LatencyTrace) {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+	t.addLocked(StageGlove, trace.Queued-trace.Captured)
+	t.addLocked(StageLink, trace.Received-trace.Queued)
+}
+
+// ObservePunch records the server stages of a punch whose state was
+// written to a WebSocket client at sentUs.
+func (t *LatencyTracker) ObservePunch(punch *PunchLatency, sentUs int64) {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+	t.addLocked(StageAnalysis, punch.Detected-punch.Received)
+	t.addLocked(StageDashboard, sentUs-punch.Detected)
+	t.addLocked(StageEndToEnd, sentUs-punch.Captured)
+}
+
+// Stats returns the percentiles of every stage measured so far.
+func (t *LatencyTracker) Stats() map[string]LatencyStats {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
+	stats := make(map[string]LatencyStats, len(t.stages))
+	for stage, ring := range t.stages {
+		sorted := make([]int64, ring.n)
+		copy(sorted, ring.us[:ring.n])
+		sort.Slice(sorted, func(i, j int) bool { return sorted[i] < sorted[j] })
+
+		// Nearest rank
+		at := func(p float64) float64 {
+			i := int(math.Ceil(p*float64(len(sorted)))) - 1
+			return float64(sorted[i]) / 1000
+		}
+		stats[stage] = LatencyStats{
+			Count: ring.n,
+			P50Ms: at(0.50),
+			P90Ms: at(0.90),
+			P99Ms: at(0.99),
+			MaxMs: float64(sorted[len(sorted)-1]) / 1000,
+		}
+	}
+	return stats
+}
@@ -0,0 +1,152 @@
+package analytics
+
+import (
+	"bufio"
+	"encoding/csv"
+	"fmt"
+	"io"
+	"os"
+	"path/filepath"
+	"strconv"
+	"sync"
+	"time"
+
+	"boxing-analytics/ble"
+)
+
+// ─── Sample Traces ───────────────────────────────────────────────────────────
+
+// Sample traces are CSV files of one glove's live samples in packet units
+// (m/s² × AccelScale, °/s × GyroScale), stamped in µs since the first
+// sample on the server clock. The firmware's native trace replay
+// (firmware/bench) reads the same files.
+const traceHeader = "timestamp_us,acc_x,acc_y,acc_z,gyro_x,gyro_y,gyro_z"
+
+// TraceRecorder writes each hand's live samples to its own trace file in a
+// directory, one file per hand per server run.
+type TraceRecorder struct {
+	mu    sync.Mutex
+	dir   string
+	files map[ble.Hand]*traceFile
+}
+
+type traceFile struct {
+	f     *os.File
+	w     *bufio.Writer
+	start int64 // server clock of the first sample, µs
+}
+
+// NewTraceRecorder records into dir, creating it if needed.
+func NewTraceRecorder(dir string) (*TraceRecorder, error) {
+	if err := os.MkdirAll(dir, 0o755); err != nil {
+		return nil, fmt.Errorf("trace directory: %w", err)
+	}
+	return &TraceRecorder{dir: dir, files: make(map[ble.Hand]*traceFile)}, nil
+}
+
+// Record appends one live sample. The hand's file is created on its first
+// sample.
+func (r *TraceRecorder) Record(hand ble.Hand, packet *ble.SensorPacket) error {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+
+	tf, ok := r.files[hand]
+	if !ok {
+		name := fmt.Sprintf("%s-%s.csv", hand, time.Now().Format("20060102-150405"))
+		f, err := os.Create(filepath.Join(r.dir, name))
+		if err != nil {
+			return fmt.Errorf("trace file: %w", err)
+		}
+		tf = &traceFile{f: f, w: bufio.NewWriter(f), start: packet.Time}
+		fmt.Fprintln(tf.w, traceHeader)
+		r.files[hand] = tf
+	}
+	_, err := fmt.Fprintf(tf.w, "%d,%d,%d,%d,%d,%d,%d\n", packet.Time-tf.start,
+		packet.AccX, packet.AccY, packet.AccZ, packet.GyroX, packet.GyroY, packet.GyroZ)
+	return err
+}
+
+// Flush writes buffered samples out to the files.
+func (r *TraceRecorder) Flush() {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	for _, tf := range r.files {
+		tf.w.Flush()
+	}
+}
+
+// Close flushes and closes every trace file.
+func (r *TraceRecorder) Close() error {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+
+	var first error
+	for hand, tf := range r.files {
+		if err := tf.w.Flush(); err != nil && first == nil {
+			first = err
+		}
+		if err := tf.f.Close(); err != nil && first == nil {
+			first = err
+		}
+		delete(r.files, hand)
+	}
+	return first
+}
+
+// ReadTrace loads a trace file. Each packet's Time is its trace timestamp.
+func ReadTrace(path string) ([]ble.SensorPacket, error) {
+	f, err := os.Open(path)
+	if err != nil {
+		return nil, err
+	}
+	defer f.Close()
+
+	r := csv.NewReader(f)
+	r.FieldsPerRecord = 7
+	r.ReuseRecord = true
+	if _, err := r.Read(); err != nil {
+		return nil, fmt.Errorf("%s: missing header: %w", path, err)
+	}
+
+	var packets []ble.SensorPacket
+	for {
+		record, err := r.Read()
+		if err == io.EOF {
+			return packets, nil
+		}
+		if err != nil {
+			return nil, fmt.Errorf("%s: %w", path, err)
+		}
+
+		ts, err := strconv.ParseInt(record[0], 10, 64)
+		if err != nil {
+			return nil, fmt.Errorf("%s: timestamp %q: %w", path, record[0], err)
+		}
+		var axes [6]int16
+		for i := range axes {
+			v, err := strconv.ParseInt(record[i+1], 10, 16)
+			if err != nil {
+				return nil, fmt.Errorf("%s: sample %q: %w", path, record[i+1], err)
+			}
+			axes[i] = int16(v)
+		}
+		packets = append(packets, ble.SensorPacket{
+			AccX: axes[0], AccY: axes[1], AccZ: axes[2],
+			GyroX: axes[3], GyroY: axes[4], GyroZ: axes[5],
+			Timestamp: uint32(ts),
+			Sequence:  uint32(len(packets)),
+			Time:      ts,
+		})
+	}
+}
+
+// ReplayTrace runs a trace through a fresh Analyzer session, as one hand's
+// live stream, and returns the punches it counted.
+func ReplayTrace(packets []ble.SensorPacket) int {
+	a := NewAnalyzer()
+	a.StartSession()
+	for i := range packets {
+		a.ProcessPacket(ble.LeftHand, &packets[i])
+	}
+	return a.GetState().Left.PunchCount
+}
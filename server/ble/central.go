@@ -35,6 +35,11 @@ var (
 	SensorCharUUID  = bluetooth.NewUUID([16]byte{0xfb, 0x34, 0x9b, 0x5f, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0x35, 0x12, 0x00, 0x00})
 	BatteryCharUUID = bluetooth.NewUUID([16]byte{0xfb, 0x34, 0x9b, 0x5f, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0x36, 0x12, 0x00, 0x00})
 	DeviceCharUUID  = bluetooth.NewUUID([16]byte{0xfb, 0x34, 0x9b, 0x5f, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0x37, 0x12, 0x00, 0x00})
+	ControlCharUUID = bluetooth.NewUUID([16]byte{0xfb, 0x34, 0x9b, 0x5f, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0x38, 0x12, 0x00, 0x00})
+	StatusCharUUID  = bluetooth.NewUUID([16]byte{0xfb, 0x34, 0x9b, 0x5f, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0x39, 0x12, 0x00, 0x00})
+	SyncCharUUID    = bluetooth.NewUUID([16]byte{0xfb, 0x34, 0x9b, 0x5f, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0x3a, 0x12, 0x00, 0x00})
+	BulkCharUUID    = bluetooth.NewUUID([16]byte{0xfb, 0x34, 0x9b, 0x5f, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0x3b, 0x12, 0x00, 0x00})
+	DiagCharUUID    = bluetooth.NewUUID([16]byte{0xfb, 0x34, 0x9b, 0x5f, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0x3c, 0x12, 0x00, 0x00})
 )
 
 // Device names for scanning
@@ -46,8 +51,13 @@ const (
 // Standard big-endian UUID strings as BlueZ returns them in GetManagedObjects.
 // bluetooth.UUID.String() outputs little-endian bytes and does NOT match these.
 const (
-	serviceUUIDStr    = "00001234-0000-1000-8000-00805f9b34fb"
-	sensorCharUUIDStr = "00001235-0000-1000-8000-00805f9b34fb"
+	serviceUUIDStr     = "00001234-0000-1000-8000-00805f9b34fb"
+	sensorCharUUIDStr  = "00001235-0000-1000-8000-00805f9b34fb"
+	controlCharUUIDStr = "00001238-0000-1000-8000-00805f9b34fb"
+	statusCharUUIDStr  = "00001239-0000-1000-8000-00805f9b34fb"
+	syncCharUUIDStr    = "0000123a-0000-1000-8000-00805f9b34fb"
+	bulkCharUUIDStr    = "0000123b-0000-1000-8000-00805f9b34fb"
+	diagCharUUIDStr    = "0000123c-0000-1000-8000-00805f9b34fb"
 )
 
 // GloveConnection represents a connected glove.
@@ -57,23 +67,54 @@ type GloveConnection struct {
 	Device         *bluetooth.Device
 	Address        bluetooth.Address
 	SensorChar     *gatt.GattCharacteristic1
+	ControlChar    *gatt.GattCharacteristic1 // nil on firmware without runtime control
+	StreamConfig   StreamConfig              // Configuration the glove reports as active
+	StatusChar     *gatt.GattCharacteristic1 // nil on firmware without link status
+	SyncChar       *gatt.GattCharacteristic1 // nil on firmware without clock sync
+	Clock          *Clock                    // Glove clock → server clock
+	BulkChar       *gatt.GattCharacteristic1 // nil on firmware without the disconnect log
+	DiagChar       *gatt.GattCharacteristic1 // nil on firmware without diagnostics
 	PropCh         chan *bluez.PropertyChanged
+	SyncPropCh     chan *bluez.PropertyChanged
+	BulkPropCh     chan *bluez.PropertyChanged
+	Backfilled     int // Samples replayed from the glove's disconnect log
 	Connected      bool
-	LastSeq        uint16
-	PacketLoss     float64
+	LastSeq        uint32
+	LastPunchCount uint16    // Last on-glove punch number (event-only mode)
+	PacketLoss     float64   // % of samples lost for good (not recovered by a resend)
 	LastPacketTime time.Time // For packet timeout detection
+
+	seq sequenceTracker
+
+	// Timestamp (as sent: its first sample's) and arrival time of the last
+	// sensor-characteristic frame, which the latency trace that may follow
+	// it refers to
+	lastFrameTimestamp uint32
+	lastFrameReceived  int64
 }
 
 // PacketHandler is called when a sensor packet is received.
 type PacketHandler func(hand Hand, packet *SensorPacket)
 
+// PunchHandler is called when a glove reports a punch it detected itself
+// (event-only streaming mode). Heartbeat records are delivered too.
+type PunchHandler func(hand Hand, record *PunchRecord)
+
 // DisconnectHandler is called when a glove disconnects.
 type DisconnectHandler func(hand Hand, deviceName string)
 
+// LatencyHandler is called for every frame a glove traced.
+type LatencyHandler func(hand Hand, trace *LatencyTrace)
+
 // Connection timeout constants
 const (
 	PacketTimeoutDuration   = 3 * time.Second // Assume disconnect if no packets for this long
 	ConnectionCheckInterval = 500 * time.Millisecond
+	ControlApplyDelay       = 100 * time.Millisecond // Glove applies a control write between samples
+
+	// Sensor frames per latency trace the gloves are asked for; every
+	// frame in event-only mode, where frames are punches and heartbeats
+	LatencyTraceEvery = 20
 )
 
 // Central manages BLE connections to FighterLink gloves.
@@ -85,7 +126,11 @@ type Central struct {
 	rightGlove *GloveConnection
 
 	onPacket     PacketHandler
+	onBackfill   PacketHandler
+	onPunch      PunchHandler
 	onDisconnect DisconnectHandler
+	onLatency    LatencyHandler
+	streamConfig *StreamConfig // Requested per session; nil keeps the glove's defaults
 	scanning     bool
 	stopScan     chan struct{}
 	stopMonitor  chan struct{} // For stopping the connection monitor
@@ -107,6 +152,29 @@ func (c *Central) SetPacketHandler(handler PacketHandler) {
 	c.onPacket = handler
 }
 
+// SetBackfillHandler sets the callback for samples that arrive late, out of
+// order with the live stream: those a glove logged while its link was down
+// and replays after reconnecting, and those it resends to fill gaps.
+func (c *Central) SetBackfillHandler(handler PacketHandler) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	c.onBackfill = handler
+}
+
+// SetPunchHandler sets the callback for on-glove punch events.
+func (c *Central) SetPunchHandler(handler PunchHandler) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	c.onPunch = handler
+}
+
+// SetLatencyHandler sets the callback for latency traces.
+func (c *Central) SetLatencyHandler(handler LatencyHandler) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	c.onLatency = handler
+}
+
 // SetDisconnectHandler sets the callback for glove disconnection events.
 func (c *Central) SetDisconnectHandler(handler DisconnectHandler) {
 	c.mu.Lock()
@@ -114,6 +182,173 @@ func (c *Central) SetDisconnectHandler(handler DisconnectHandler) {
 	c.onDisconnect = handler
 }
 
+// SetStreamConfig selects how gloves stream for this session. It is written
+// to every connected glove now and to each glove as it (re)connects, since
+// gloves revert to their defaults on disconnect.
+func (c *Central) SetStreamConfig(config StreamConfig) {
+	c.mu.Lock()
+	c.streamConfig = &config
+	gloves := []*GloveConnection{c.leftGlove, c.rightGlove}
+	c.mu.Unlock()
+
+	for _, glove := range gloves {
+		if glove != nil && glove.Connected {
+			if err := c.configureStream(glove); err != nil {
+				log.Printf("BLE: %v", err)
+			}
+		}
+	}
+}
+
+// StreamConfig returns the configuration the glove reports as active.
+func (c *Central) StreamConfig(hand Hand) (StreamConfig, bool) {
+	c.mu.RLock()
+	defer c.mu.RUnlock()
+	glove := c.leftGlove
+	if hand == RightHand {
+		glove = c.rightGlove
+	}
+	if glove == nil || !glove.Connected || glove.ControlChar == nil {
+		return StreamConfig{}, false
+	}
+	return glove.StreamConfig, true
+}
+
+// LinkStatus reads the link parameters the glove reports as granted.
+func (c *Central) LinkStatus(hand Hand) (LinkStatus, error) {
+	glove := c.GetGlove(hand)
+	if glove == nil || !glove.Connected {
+		return LinkStatus{}, fmt.Errorf("%s glove not connected", hand)
+	}
+	if glove.StatusChar == nil {
+		return LinkStatus{}, fmt.Errorf("%s has no link status characteristic", glove.Name)
+	}
+
+	value, err := glove.StatusChar.ReadValue(nil)
+	if err != nil {
+		return LinkStatus{}, fmt.Errorf("link status read from %s failed: %w", glove.Name, err)
+	}
+	return ParseLinkStatus(value)
+}
+
+// Diagnostics reads the glove's hot-path timing and on-glove loss counters,
+// as of its last diagnostics window.
+func (c *Central) Diagnostics(hand Hand) (Diagnostics, error) {
+	glove := c.GetGlove(hand)
+	if glove == nil || !glove.Connected {
+		return Diagnostics{}, fmt.Errorf("%s glove not connected", hand)
+	}
+	if glove.DiagChar == nil {
+		return Diagnostics{}, fmt.Errorf("%s has no diagnostics characteristic", glove.Name)
+	}
+
+	value, err := glove.DiagChar.ReadValue(nil)
+	if err != nil {
+		return Diagnostics{}, fmt.Errorf("diagnostics read from %s failed: %w", glove.Name, err)
+	}
+	return ParseDiagnostics(value)
+}
+
+// PacketLoss returns the share of samples lost for good between the glove
+// and the server, in %.
+func (c *Central) PacketLoss(hand Hand) (float64, bool) {
+	c.mu.RLock()
+	defer c.mu.RUnlock()
+	glove := c.leftGlove
+	if hand == RightHand {
+		glove = c.rightGlove
+	}
+	if glove == nil || !glove.Connected {
+		return 0, false
+	}
+	return glove.PacketLoss, true
+}
+
+// ClockStatus reports how the glove's timestamps are mapped onto the
+// server clock.
+func (c *Central) ClockStatus(hand Hand) (ClockStatus, bool) {
+	glove := c.GetGlove(hand)
+	if glove == nil || !glove.Connected {
+		return ClockStatus{}, false
+	}
+	return glove.Clock.Status(), true
+}
+
+// configureStream writes the session's stream configuration to a glove and
+// reads back what it applied. The glove ignores writes it cannot honour
+// (e.g. a rate its build does not support), which shows up as a mismatch.
+func (c *Central) configureStream(glove *GloveConnection) error {
+	c.mu.RLock()
+	requested := c.streamConfig
+	c.mu.RUnlock()
+
+	if glove.ControlChar == nil {
+		if requested != nil {
+			return fmt.Errorf("%s has no control characteristic, keeping its defaults", glove.Name)
+		}
+		return nil
+	}
+
+	apply := func(config *StreamConfig) (StreamConfig, byte, error) {
+		if config != nil {
+			if err := glove.ControlChar.WriteValue(config.Commands(), nil); err != nil {
+				return StreamConfig{}, 0, fmt.Errorf("stream config write to %s failed: %w", glove.Name, err)
+			}
+			time.Sleep(ControlApplyDelay)
+		}
+		value, err := glove.ControlChar.ReadValue(nil)
+		if err != nil {
+			return StreamConfig{}, 0, fmt.Errorf("stream config read from %s failed: %w", glove.Name, err)
+		}
+		active, err := ParseStreamConfig(value)
+		if err != nil {
+			return StreamConfig{}, 0, fmt.Errorf("%s: %w", glove.Name, err)
+		}
+		return active, value[0], nil
+	}
+
+	active, version, err := apply(requested)
+	if err != nil {
+		return err
+	}
+
+	// Firmware from before frame formats rejects the whole write: ask again
+	// in the packet units it can send
+	if requested != nil && active != *requested && requested.Format != FrameFormatPacket && version < StreamConfigVersion {
+		fallback := *requested
+		fallback.Format = FrameFormatPacket
+		log.Printf("BLE: %s predates LSB frames, asking for packet units", glove.Name)
+		if active, _, err = apply(&fallback); err != nil {
+			return err
+		}
+		requested = &fallback
+	}
+
+	c.mu.Lock()
+	glove.StreamConfig = active
+	c.mu.Unlock()
+	c.traceLatency(glove, active)
+
+	if requested != nil && active != *requested {
+		return fmt.Errorf("%s rejected stream config %s, streaming %s", glove.Name, requested, active)
+	}
+	log.Printf("BLE: %s streaming %s", glove.Name, active)
+	return nil
+}
+
+// traceLatency asks the glove for latency traces at the rate that suits
+// what it streams. Firmware without them rejects the write and never sends
+// any.
+func (c *Central) traceLatency(glove *GloveConnection, active StreamConfig) {
+	every := uint8(LatencyTraceEvery)
+	if active.Mode == StreamModeEvents {
+		every = 1
+	}
+	if err := glove.ControlChar.WriteValue(LatencyCommand(every), nil); err != nil {
+		log.Printf("BLE: latency trace request to %s failed: %v", glove.Name, err)
+	}
+}
+
 // Enable initializes the BLE adapter.
 func (c *Central) Enable() error {
 	log.Println("BLE: Enabling adapter...")
@@ -333,9 +568,21 @@ func (c *Central) BothConnected() bool {
 }
 
 // handleNotification processes incoming BLE notifications.
+// A notification carries one or more samples; each is delivered to the
+// packet handler in order.
 func (c *Central) handleNotification(hand Hand) func([]byte) {
 	return func(data []byte) {
-		packet, err := ParsePacket(data)
+		received := time.Now().UnixMicro()
+		if IsLatencyFrame(data) {
+			c.handleLatencyTrace(hand, data)
+			return
+		}
+		if IsPunchFrame(data) {
+			c.handlePunchRecord(hand, data, received)
+			return
+		}
+
+		packets, err := ParseFrame(data)
 		if err != nil {
 			log.Printf("BLE: Failed to parse packet from %s: %v", hand, err)
 			return
@@ -347,32 +594,236 @@ func (c *Central) handleNotification(hand Hand) func([]byte) {
 		if hand == RightHand {
 			glove = c.rightGlove
 		}
+		var clock *Clock
+		var gaps []seqRange
 		if glove != nil {
+			clock = glove.Clock
+
 			// Update last packet time for timeout detection
-			glove.LastPacketTime = time.Now()
-
-			if glove.LastSeq > 0 {
-				expected := glove.LastSeq + 1
-				if packet.Sequence != expected && packet.Sequence != 0 {
-					// Calculate packet loss (simple approximation)
-					missed := int(packet.Sequence) - int(expected)
-					if missed > 0 && missed < 100 {
-						glove.PacketLoss = float64(missed) / float64(packet.Sequence) * 100
-					}
+			now := time.Now()
+			glove.LastPacketTime = now
+
+			// A 20-byte packet only carries the low 16 bits of its sequence
+			full := len(data) != PacketSize
+			for _, packet := range packets {
+				if !full {
+					packet.Sequence = glove.seq.extend(uint16(packet.Sequence))
 				}
+				if gap, ok := glove.seq.observe(packet.Sequence, full, now); ok {
+					gaps = append(gaps, gap)
+				}
+				glove.LastSeq = packet.Sequence
+			}
+			glove.seq.expire(now)
+			glove.PacketLoss = glove.seq.lossPercent()
+			if len(packets) > 0 {
+				glove.lastFrameTimestamp = packets[0].Timestamp
+				glove.lastFrameReceived = received
 			}
-			glove.LastSeq = packet.Sequence
 		}
 		handler := c.onPacket
 		c.mu.Unlock()
 
+		// Ask for the gaps back if the glove keeps a resend buffer
+		if len(gaps) > 0 && glove.ControlChar != nil && glove.BulkChar != nil {
+			go c.requestResend(glove, gaps)
+		}
+
+		// Place every sample on the server timeline
+		if clock != nil && len(packets) > 0 {
+			clock.ObserveArrival(packets[len(packets)-1].Timestamp, received)
+			for _, packet := range packets {
+				packet.Time = clock.ToServer(packet.Timestamp)
+			}
+		}
+		for _, packet := range packets {
+			packet.Received = received
+		}
+
 		// Call the packet handler
 		if handler != nil {
-			handler(hand, packet)
+			for _, packet := range packets {
+				handler(hand, packet)
+			}
+		}
+	}
+}
+
+// handlePunchRecord processes a punch event or heartbeat from a glove
+// running on-glove detection.
+func (c *Central) handlePunchRecord(hand Hand, data []byte, received int64) {
+	record, err := ParsePunchRecord(data)
+	if err != nil {
+		log.Printf("BLE: Failed to parse punch record from %s: %v", hand, err)
+		return
+	}
+
+	c.mu.Lock()
+	glove := c.leftGlove
+	if hand == RightHand {
+		glove = c.rightGlove
+	}
+	record.Received = received
+	if glove != nil {
+		glove.LastPacketTime = time.Now()
+		glove.Clock.ObserveArrival(record.Timestamp, received)
+		record.Time = glove.Clock.ToServer(record.Timestamp)
+		glove.lastFrameTimestamp = record.Timestamp
+		glove.lastFrameReceived = received
+
+		// Heartbeats repeat the latest count, punches advance it by one;
+		// anything beyond that means events were lost on air
+		expected := glove.LastPunchCount
+		if !record.IsHeartbeat() {
+			expected++
+		}
+		if glove.LastPunchCount > 0 && record.Count > expected {
+			log.Printf("BLE: %s glove lost %d punch event(s)", hand, record.Count-expected)
+		}
+		glove.LastPunchCount = record.Count
+	}
+	handler := c.onPunch
+	c.mu.Unlock()
+
+	if handler != nil {
+		handler(hand, record)
+	}
+}
+
+// handleLatencyTrace matches a latency trace to the frame it follows and
+// places its glove stamps on the server clock. A trace whose frame was lost
+// on air would describe some other frame, so it is dropped.
+func (c *Central) handleLatencyTrace(hand Hand, data []byte) {
+	captured, queued, err := ParseLatencyFrame(data)
+	if err != nil {
+		return
+	}
+
+	c.mu.RLock()
+	glove := c.leftGlove
+	if hand == RightHand {
+		glove = c.rightGlove
+	}
+	if glove == nil || glove.lastFrameReceived == 0 || glove.lastFrameTimestamp != captured {
+		c.mu.RUnlock()
+		return
+	}
+	trace := &LatencyTrace{
+		Captured: glove.Clock.ToServer(captured),
+		Queued:   glove.Clock.ToServer(queued),
+		Received: glove.lastFrameReceived,
+	}
+	handler := c.onLatency
+	c.mu.RUnlock()
+
+	if handler != nil {
+		handler(hand, trace)
+	}
+}
+
+// handleBackfill processes one frame on the bulk characteristic: either
+// replayed from the glove's disconnect log or resent to fill a gap in the
+// live stream. The samples keep their original sequence numbers and glove
+// timestamps; only those still missing are delivered. An empty frame ends
+// the disconnect log backlog.
+func (c *Central) handleBackfill(glove *GloveConnection, data []byte) {
+	packets, err := ParseFrame(data)
+	if err != nil {
+		log.Printf("BLE: Failed to parse backfill from %s: %v", glove.Name, err)
+		return
+	}
+
+	c.mu.Lock()
+	glove.LastPacketTime = time.Now()
+	if len(packets) == 0 {
+		log.Printf("BLE: %s backfill complete (%d samples)", glove.Name, glove.Backfilled)
+		glove.Backfilled = 0
+	}
+	late := packets[:0]
+	for _, packet := range packets {
+		if len(data) == PacketSize {
+			packet.Sequence = glove.seq.extend(uint16(packet.Sequence))
+		}
+		if glove.seq.predates(packet.Sequence) {
+			glove.Backfilled++
+		}
+		if glove.seq.claim(packet.Sequence) {
+			late = append(late, packet)
+		}
+	}
+	glove.PacketLoss = glove.seq.lossPercent()
+	handler := c.onBackfill
+	c.mu.Unlock()
+
+	// Same glove clock as the live stream (no reboot in between), so the
+	// mapping the live samples established applies
+	for _, packet := range late {
+		packet.Time = glove.Clock.ToServer(packet.Timestamp)
+	}
+	if handler != nil {
+		for _, packet := range late {
+			handler(glove.Hand, packet)
 		}
 	}
 }
 
+// requestResend asks the glove to resend gaps in the live stream. It runs
+// off the notification goroutine because each write waits for the glove's
+// response.
+func (c *Central) requestResend(glove *GloveConnection, gaps []seqRange) {
+	for _, gap := range gaps {
+		cmd := ResendCommand(gap.first, uint16(gap.end-gap.first))
+		if err := glove.ControlChar.WriteValue(cmd, nil); err != nil {
+			log.Printf("BLE: Resend request to %s failed: %v", glove.Name, err)
+			return
+		}
+	}
+}
+
+// handleSyncEcho processes the glove's answer to a clock sync ping.
+func (c *Central) handleSyncEcho(glove *GloveConnection, data []byte, recvUs int64) {
+	echo, err := ParseSyncEcho(data)
+	if err == nil {
+		err = glove.Clock.HandleEcho(echo, recvUs)
+	}
+	if err != nil {
+		log.Printf("BLE: %s: %v", glove.Name, err)
+	}
+}
+
+// syncClock runs a burst of clock sync pings every SyncInterval until the
+// glove disconnects. Pings are written without response so each one costs
+// a single connection event.
+func (c *Central) syncClock(glove *GloveConnection) {
+	options := map[string]interface{}{"type": "command"}
+	synced := false
+	for {
+		for i := 0; i < SyncBurst; i++ {
+			c.mu.RLock()
+			connected := glove.Connected
+			c.mu.RUnlock()
+			if !connected {
+				return
+			}
+
+			ping := glove.Clock.BeginPing(time.Now().UnixMicro())
+			if err := glove.SyncChar.WriteValue(ping, options); err != nil {
+				log.Printf("BLE: Clock sync ping to %s failed: %v", glove.Name, err)
+			}
+			time.Sleep(SyncPingSpacing)
+		}
+		time.Sleep(SyncEchoTimeout)
+
+		if glove.Clock.EndBurst() && !synced {
+			synced = true
+			status := glove.Clock.Status()
+			log.Printf("BLE: %s clock synced, offset %dµs, round trip %dµs",
+				glove.Name, status.OffsetUs, status.DelayUs)
+		}
+		time.Sleep(SyncInterval)
+	}
+}
+
 // waitForServicesResolved blocks until BlueZ reports ServicesResolved = true
 // for the given device address, or until the timeout expires.
 //
@@ -573,6 +1024,24 @@ func discoverGATT(addr bluetooth.Address, serviceUUIDStr, charUUIDStr string) (*
 	return char, nil
 }
 
+// subscribeChar finds an optional notifying characteristic and starts its
+// notifications.
+func subscribeChar(addr bluetooth.Address, charUUIDStr string) (*gatt.GattCharacteristic1, chan *bluez.PropertyChanged, error) {
+	char, err := discoverGATT(addr, serviceUUIDStr, charUUIDStr)
+	if err != nil {
+		return nil, nil, err
+	}
+	propCh, err := char.WatchProperties()
+	if err != nil {
+		return nil, nil, fmt.Errorf("WatchProperties failed: %w", err)
+	}
+	if err := char.StartNotify(); err != nil {
+		_ = char.UnwatchProperties(propCh)
+		return nil, nil, fmt.Errorf("StartNotify failed: %w", err)
+	}
+	return char, propCh, nil
+}
+
 // connectToDevice establishes a connection to a discovered glove.
 func (c *Central) connectToDevice(result bluetooth.ScanResult, hand Hand) error {
 	log.Printf("BLE: Connecting to %s (%s)...", result.LocalName(), result.Address.String())
@@ -621,6 +1090,39 @@ func (c *Central) connectToDevice(result bluetooth.ScanResult, hand Hand) error
 
 	deviceName := result.LocalName()
 
+	// The control characteristic is optional: older firmware streams its
+	// compiled-in defaults.
+	controlChar, err := discoverGATT(result.Address, serviceUUIDStr, controlCharUUIDStr)
+	if err != nil {
+		log.Printf("BLE: No stream control on %s: %v", deviceName, err)
+		controlChar = nil
+	}
+	statusChar, err := discoverGATT(result.Address, serviceUUIDStr, statusCharUUIDStr)
+	if err != nil {
+		log.Printf("BLE: No link status on %s: %v", deviceName, err)
+		statusChar = nil
+	}
+	diagChar, err := discoverGATT(result.Address, serviceUUIDStr, diagCharUUIDStr)
+	if err != nil {
+		log.Printf("BLE: No diagnostics on %s: %v", deviceName, err)
+		diagChar = nil
+	}
+
+	// Firmware with clock sync stamps in µs; older builds stamp in ms and
+	// are only aligned on packet arrival.
+	clock := NewClock(time.Microsecond)
+	syncChar, syncPropCh, err := subscribeChar(result.Address, syncCharUUIDStr)
+	if err != nil {
+		log.Printf("BLE: No clock sync on %s: %v", deviceName, err)
+		clock = NewClock(time.Millisecond)
+	}
+
+	// Backfill of samples logged while the link was down
+	bulkChar, bulkPropCh, err := subscribeChar(result.Address, bulkCharUUIDStr)
+	if err != nil {
+		log.Printf("BLE: No disconnect log on %s: %v", deviceName, err)
+	}
+
 	// Create glove connection record.
 	glove := &GloveConnection{
 		Hand:           hand,
@@ -628,7 +1130,15 @@ func (c *Central) connectToDevice(result bluetooth.ScanResult, hand Hand) error
 		Device:         device,
 		Address:        result.Address,
 		SensorChar:     sensorChar,
+		ControlChar:    controlChar,
+		StatusChar:     statusChar,
+		SyncChar:       syncChar,
+		Clock:          clock,
+		BulkChar:       bulkChar,
+		DiagChar:       diagChar,
 		PropCh:         propCh,
+		SyncPropCh:     syncPropCh,
+		BulkPropCh:     bulkPropCh,
 		Connected:      true,
 		LastPacketTime: time.Now(), // Initialize to avoid immediate timeout
 	}
@@ -661,6 +1171,31 @@ func (c *Central) connectToDevice(result bluetooth.ScanResult, hand Hand) error
 	// Start watching for device disconnection via D-Bus
 	go c.watchDeviceConnection(result.Address, hand, deviceName)
 
+	if syncChar != nil {
+		go func() {
+			for update := range syncPropCh {
+				if update != nil && update.Interface == "org.bluez.GattCharacteristic1" && update.Name == "Value" {
+					c.handleSyncEcho(glove, update.Value.([]byte), time.Now().UnixMicro())
+				}
+			}
+		}()
+		go c.syncClock(glove)
+	}
+	if bulkChar != nil {
+		go func() {
+			for update := range bulkPropCh {
+				if update != nil && update.Interface == "org.bluez.GattCharacteristic1" && update.Name == "Value" {
+					c.handleBackfill(glove, update.Value.([]byte))
+				}
+			}
+		}()
+	}
+
+	// Negotiate the session's stream configuration
+	if err := c.configureStream(glove); err != nil {
+		log.Printf("BLE: %v", err)
+	}
+
 	log.Printf("BLE: Connection established with %s (%s hand)", deviceName, hand)
 	return nil
 }
@@ -787,6 +1322,14 @@ func (c *Central) Disconnect(hand Hand) error {
 				_ = glove.SensorChar.UnwatchProperties(glove.PropCh)
 			}
 		}
+		if glove.SyncChar != nil {
+			_ = glove.SyncChar.StopNotify()
+			_ = glove.SyncChar.UnwatchProperties(glove.SyncPropCh)
+		}
+		if glove.BulkChar != nil {
+			_ = glove.BulkChar.StopNotify()
+			_ = glove.BulkChar.UnwatchProperties(glove.BulkPropCh)
+		}
 		if err := glove.Device.Disconnect(); err != nil {
 			return fmt.Errorf("failed to disconnect %s glove: %w", hand, err)
 		}
@@ -0,0 +1,263 @@
+package ble
+
+import (
+	"encoding/binary"
+	"fmt"
+	"math"
+	"sync"
+	"time"
+)
+
+// Clock sync exchange sizes (see firmware/lib/FighterLink/src/clock_sync.h).
+const (
+	SyncPingSize = 4
+	SyncEchoSize = 12
+)
+
+// Sync schedule: a burst of pings every SyncInterval; the exchange with the
+// shortest round trip in each burst becomes one offset sample.
+const (
+	SyncInterval    = 10 * time.Second
+	SyncBurst       = 8
+	SyncPingSpacing = 20 * time.Millisecond
+	SyncEchoTimeout = 200 * time.Millisecond // Wait for the last echo of a burst
+
+	syncWindow     = 32    // Offset samples kept for the drift fit (~5 min)
+	maxDriftPPM    = 500.0 // Crystals are ±50ppm; anything steeper is noise
+	arrivalSlewPPM = 200   // How fast the arrival-time bound may fall
+)
+
+// SyncEcho is a glove's answer to a clock sync ping.
+type SyncEcho struct {
+	Token  uint32 // From the ping
+	RxTime uint32 // µs, ping received (glove clock)
+	TxTime uint32 // µs, echo sent (glove clock)
+}
+
+// ParseSyncEcho decodes a 12-byte sync characteristic notification.
+func ParseSyncEcho(data []byte) (SyncEcho, error) {
+	if len(data) != SyncEchoSize {
+		return SyncEcho{}, fmt.Errorf("%w: sync echo (%d bytes)", ErrInvalidFrame, len(data))
+	}
+	return SyncEcho{
+		Token:  binary.LittleEndian.Uint32(data[0:4]),
+		RxTime: binary.LittleEndian.Uint32(data[4:8]),
+		TxTime: binary.LittleEndian.Uint32(data[8:12]),
+	}, nil
+}
+
+// ClockStatus reports how a glove's clock is mapped onto the server's.
+type ClockStatus struct {
+	Synced   bool    `json:"synced"`    // false: aligned on packet arrival only
+	OffsetUs int64   `json:"offset_us"` // Glove clock − server clock, now
+	DriftPPM float64 `json:"drift_ppm"` // Glove clock rate relative to the server's
+	DelayUs  int64   `json:"delay_us"`  // Round trip of the last accepted exchange
+	Samples  int     `json:"samples"`   // Offset samples in the drift fit
+}
+
+// syncPoint is one offset measurement at a glove time (both µs).
+type syncPoint struct {
+	device int64
+	offset int64
+	delay  int64
+}
+
+// Clock maps one glove's 32-bit sample clock onto the server clock (µs
+// since the Unix epoch), so both hands' samples share one timeline.
+//
+// Ping/echo exchanges give offset samples; a least-squares line through the
+// recent ones tracks drift between them. Until the first exchange completes
+// (or on firmware without the sync characteristic) the offset is bounded
+// from packet arrivals instead: a sample can't arrive before it was taken.
+type Clock struct {
+	mu     sync.Mutex
+	tickUs int64 // µs per glove clock tick
+
+	// Unwrapping of the 32-bit counter
+	started  bool
+	lastRaw  uint32
+	lastTick int64
+
+	// Ping/echo estimate: offset(d) = intercept + slope·(d − refDevice)
+	nextToken uint32
+	pending   map[uint32]int64 // Token → send time of pings awaiting an echo
+	burst     *syncPoint       // Best exchange of the burst in progress
+	points    []syncPoint
+	intercept float64
+	slope     float64
+	refDevice int64
+
+	// Arrival-time bound, used until the first exchange
+	arrivalOffset int64
+	arrivalHost   int64
+	haveArrival   bool
+}
+
+// NewClock creates a mapping for a glove clock ticking once per tick
+// (time.Microsecond for current firmware, time.Millisecond for older
+// builds without clock sync).
+func NewClock(tick time.Duration) *Clock {
+	return &Clock{
+		tickUs:  tick.Microseconds(),
+		pending: make(map[uint32]int64),
+	}
+}
+
+// unwrapLocked extends a raw 32-bit reading to a monotonic tick count.
+// Readings slightly older than the newest (earlier records of a batch) map
+// back without moving the reference.
+func (c *Clock) unwrapLocked(raw uint32) int64 {
+	if !c.started {
+		c.started = true
+		c.lastRaw = raw
+		c.lastTick = int64(raw)
+		return c.lastTick
+	}
+	tick := c.lastTick + int64(int32(raw-c.lastRaw))
+	if tick > c.lastTick {
+		c.lastRaw = raw
+		c.lastTick = tick
+	}
+	return tick
+}
+
+func (c *Clock) deviceUsLocked(raw uint32) int64 {
+	return c.unwrapLocked(raw) * c.tickUs
+}
+
+// offsetLocked estimates glove − server clock at glove time d (µs).
+func (c *Clock) offsetLocked(d int64) int64 {
+	if len(c.points) > 0 {
+		return int64(math.Round(c.intercept + c.slope*float64(d-c.refDevice)))
+	}
+	return c.arrivalOffset
+}
+
+// ObserveArrival records that a sample stamped raw arrived at server time
+// hostUs. Call it with the newest sample of each notification.
+func (c *Clock) ObserveArrival(raw uint32, hostUs int64) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	bound := c.deviceUsLocked(raw) - hostUs
+	if c.haveArrival {
+		// Let the bound fall slowly so it can follow drift
+		decayed := c.arrivalOffset - (hostUs-c.arrivalHost)*arrivalSlewPPM/1e6
+		if bound < decayed {
+			bound = decayed
+		}
+	}
+	c.arrivalOffset = bound
+	c.arrivalHost = hostUs
+	c.haveArrival = true
+}
+
+// ToServer converts a glove timestamp to server time (µs since the epoch).
+func (c *Clock) ToServer(raw uint32) int64 {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	d := c.deviceUsLocked(raw)
+	return d - c.offsetLocked(d)
+}
+
+// BeginPing returns the payload of a new ping sent at server time sentUs.
+func (c *Clock) BeginPing(sentUs int64) []byte {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	c.nextToken++
+	c.pending[c.nextToken] = sentUs
+
+	ping := make([]byte, SyncPingSize)
+	binary.LittleEndian.PutUint32(ping, c.nextToken)
+	return ping
+}
+
+// HandleEcho matches an echo received at server time recvUs to its ping
+// and keeps the exchange if it has the shortest round trip of the burst.
+func (c *Clock) HandleEcho(echo SyncEcho, recvUs int64) error {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	sentUs, ok := c.pending[echo.Token]
+	if !ok {
+		return fmt.Errorf("sync echo for unknown ping %d", echo.Token)
+	}
+	delete(c.pending, echo.Token)
+
+	t1 := c.deviceUsLocked(echo.RxTime)
+	t2 := c.deviceUsLocked(echo.TxTime)
+	point := syncPoint{
+		device: (t1 + t2) / 2,
+		offset: ((t1 - sentUs) + (t2 - recvUs)) / 2,
+		delay:  (recvUs - sentUs) - (t2 - t1),
+	}
+	if c.burst == nil || point.delay < c.burst.delay {
+		c.burst = &point
+	}
+	return nil
+}
+
+// EndBurst commits the burst's best exchange and refits the offset line.
+// It returns false if no echo came back.
+func (c *Clock) EndBurst() bool {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	c.pending = make(map[uint32]int64)
+	if c.burst == nil {
+		return false
+	}
+	c.points = append(c.points, *c.burst)
+	if len(c.points) > syncWindow {
+		c.points = c.points[1:]
+	}
+	c.burst = nil
+	c.fitLocked()
+	return true
+}
+
+// fitLocked runs a least-squares line through the offset samples. With too
+// few samples to see drift the offset is held flat at their mean.
+func (c *Clock) fitLocked() {
+	n := float64(len(c.points))
+	var sumX, sumY float64
+	for _, p := range c.points {
+		sumX += float64(p.device)
+		sumY += float64(p.offset)
+	}
+	c.refDevice = int64(sumX / n)
+	c.intercept = sumY / n
+	c.slope = 0
+	if len(c.points) < 3 {
+		return
+	}
+
+	var sxx, sxy float64
+	for _, p := range c.points {
+		dx := float64(p.device - c.refDevice)
+		sxx += dx * dx
+		sxy += dx * (float64(p.offset) - c.intercept)
+	}
+	if sxx > 0 {
+		c.slope = math.Max(-maxDriftPPM/1e6, math.Min(maxDriftPPM/1e6, sxy/sxx))
+	}
+}
+
+// Status reports the current estimate.
+func (c *Clock) Status() ClockStatus {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	status := ClockStatus{
+		Synced:   len(c.points) > 0,
+		OffsetUs: c.offsetLocked(c.lastTick * c.tickUs),
+		DriftPPM: c.slope * 1e6,
+		Samples:  len(c.points),
+	}
+	if len(c.points) > 0 {
+		status.DelayUs = c.points[len(c.points)-1].delay
+	}
+	return status
+}
@@ -0,0 +1,184 @@
+package ble
+
+import (
+	"encoding/binary"
+	"fmt"
+)
+
+// Control characteristic commands (see firmware/lib/FighterLink/src/stream_control.h).
+const (
+	ControlOpProfile  uint8 = 0x01 // [op, RateProfile*]
+	ControlOpMode     uint8 = 0x02 // [op, StreamMode*]
+	ControlOpEncoding uint8 = 0x03 // [op, Encoding*]
+	ControlOpRanges   uint8 = 0x04 // [op, AccelRange*, GyroRange*]
+	ControlOpResend   uint8 = 0x05 // [op, sequence uint32, count uint16], alone in its write
+	ControlOpFormat   uint8 = 0x06 // [op, FrameFormat*], for that write only
+	ControlOpLatency  uint8 = 0x07 // [op, every uint8], alone in its write
+
+	StreamConfigVersion = 2
+	StreamConfigSize    = 7
+	streamConfigSizeV1  = 6 // Firmware without ControlOpFormat
+)
+
+// Sample-rate profiles. Each selects ODR, DLPF and default ranges on the glove.
+const (
+	RateProfile100Hz  uint8 = 0
+	RateProfile200Hz  uint8 = 1
+	RateProfile500Hz  uint8 = 2
+	RateProfile1000Hz uint8 = 3
+)
+
+// Streaming modes.
+const (
+	StreamModeRaw    uint8 = 0 // Every sample, batched when the MTU allows
+	StreamModeEvents uint8 = 1 // On-glove punch detection, PunchRecords only
+	StreamModeSingle uint8 = 2 // Every sample as a 20-byte SensorPacket
+	StreamModeFused  uint8 = 3 // As raw, plus on-glove orientation and linear acceleration
+)
+
+// Batch encodings.
+const (
+	EncodingRaw   uint8 = 0
+	EncodingDelta uint8 = 1
+)
+
+// Sample units of batched frames.
+const (
+	FrameFormatPacket uint8 = 0 // Packet units (v1 frames)
+	FrameFormatLSB    uint8 = 1 // Sensor LSB and their scale (v2 frames)
+)
+
+// Full-scale ranges.
+const (
+	AccelRange2G  uint8 = 0
+	AccelRange4G  uint8 = 1
+	AccelRange8G  uint8 = 2
+	AccelRange16G uint8 = 3
+
+	GyroRange250DPS  uint8 = 0
+	GyroRange500DPS  uint8 = 1
+	GyroRange1000DPS uint8 = 2
+	GyroRange2000DPS uint8 = 3
+)
+
+// StreamConfig is what a glove streams and how. Whatever the format,
+// parsed samples come out in packet units, and FrameFormatLSB adds the
+// sensor's full resolution (see SensorPacket.Scale).
+type StreamConfig struct {
+	Profile    uint8
+	Mode       uint8
+	Encoding   uint8
+	AccelRange uint8
+	GyroRange  uint8
+	Format     uint8
+}
+
+// Per-session presets.
+var (
+	// StreamConfigEvents sends only punches and heartbeats: the least airtime,
+	// for many gloves on one adapter (e.g. a class).
+	StreamConfigEvents = StreamConfig{RateProfile100Hz, StreamModeEvents, EncodingDelta, AccelRange2G, GyroRange500DPS, FrameFormatPacket}
+
+	// StreamConfigAnalysis streams every sample at 100Hz, at the sensor's
+	// full resolution, for server-side calibration and punch analysis.
+	StreamConfigAnalysis = StreamConfig{RateProfile100Hz, StreamModeRaw, EncodingDelta, AccelRange2G, GyroRange500DPS, FrameFormatLSB}
+
+	// StreamConfigFusion streams every sample at 200Hz with the glove's
+	// orientation, so gravity is removed along the attitude the glove
+	// tracked through the combination rather than the calibration pose.
+	StreamConfigFusion = StreamConfig{RateProfile200Hz, StreamModeFused, EncodingDelta, AccelRange8G, GyroRange1000DPS, FrameFormatLSB}
+
+	// StreamConfigSparring streams 1kHz at full scale for detailed impact
+	// analysis of one pair of gloves.
+	StreamConfigSparring = StreamConfig{RateProfile1000Hz, StreamModeRaw, EncodingDelta, AccelRange16G, GyroRange2000DPS, FrameFormatLSB}
+)
+
+// StreamPresets maps preset names to configurations.
+var StreamPresets = map[string]StreamConfig{
+	"events":   StreamConfigEvents,
+	"analysis": StreamConfigAnalysis,
+	"fusion":   StreamConfigFusion,
+	"sparring": StreamConfigSparring,
+}
+
+// RateHz returns the sample rate of the configuration's profile.
+func (c StreamConfig) RateHz() int {
+	switch c.Profile {
+	case RateProfile200Hz:
+		return 200
+	case RateProfile500Hz:
+		return 500
+	case RateProfile1000Hz:
+		return 1000
+	default:
+		return 100
+	}
+}
+
+// Commands encodes the configuration as one control write. The profile goes
+// first because it resets the ranges, which are then overridden. Packet
+// units need no format command, so the write stays valid for firmware that
+// predates it.
+func (c StreamConfig) Commands() []byte {
+	cmd := []byte{
+		ControlOpProfile, c.Profile,
+		ControlOpRanges, c.AccelRange, c.GyroRange,
+		ControlOpMode, c.Mode,
+		ControlOpEncoding, c.Encoding,
+	}
+	if c.Format != FrameFormatPacket {
+		cmd = append(cmd, ControlOpFormat, c.Format)
+	}
+	return cmd
+}
+
+// ParseStreamConfig decodes the control characteristic value. Version 1
+// (before frame formats) always streams packet units.
+func ParseStreamConfig(data []byte) (StreamConfig, error) {
+	v1 := len(data) == streamConfigSizeV1 && data[0] == 1
+	if !v1 && (len(data) != StreamConfigSize || data[0] != StreamConfigVersion) {
+		return StreamConfig{}, fmt.Errorf("%w: stream config (%d bytes)", ErrInvalidFrame, len(data))
+	}
+	config := StreamConfig{
+		Profile:    data[1],
+		Mode:       data[2],
+		Encoding:   data[3],
+		AccelRange: data[4],
+		GyroRange:  data[5],
+	}
+	if !v1 {
+		config.Format = data[6]
+	}
+	return config, nil
+}
+
+// String returns a human-readable representation of the configuration.
+func (c StreamConfig) String() string {
+	mode := map[uint8]string{StreamModeRaw: "raw", StreamModeEvents: "events", StreamModeSingle: "single", StreamModeFused: "fused"}[c.Mode]
+	encoding := "raw"
+	if c.Encoding == EncodingDelta {
+		encoding = "delta"
+	}
+	format := "packet units"
+	if c.Format == FrameFormatLSB {
+		format = "LSB"
+	}
+	return fmt.Sprintf("%dHz %s, %s encoding, ±%dg, ±%d°/s, %s",
+		c.RateHz(), mode, encoding, 2<<c.AccelRange, 250<<c.GyroRange, format)
+}
+
+// ResendCommand encodes a request for the glove to resend samples
+// [sequence, sequence+count) on the bulk characteristic.
+func ResendCommand(sequence uint32, count uint16) []byte {
+	cmd := make([]byte, 7)
+	cmd[0] = ControlOpResend
+	binary.LittleEndian.PutUint32(cmd[1:5], sequence)
+	binary.LittleEndian.PutUint16(cmd[5:7], count)
+	return cmd
+}
+
+// LatencyCommand encodes a request for the glove to follow every Nth frame
+// on the sensor characteristic with a latency trace frame; 0 stops it.
+func LatencyCommand(every uint8) []byte {
+	return []byte{ControlOpLatency, every}
+}
@@ -0,0 +1,86 @@
+package ble
+
+import (
+	"encoding/binary"
+	"fmt"
+)
+
+// DiagnosticsSize is the size of the diagnostics characteristic value
+// (see firmware/lib/FighterLink/src/diagnostics.h).
+const DiagnosticsSize = 80
+
+// JitterBuckets is the number of wake-jitter histogram buckets. Bucket n
+// counts wakes whose period changed by less than 32µs << n; the last one
+// counts everything above.
+const JitterBuckets = 8
+
+// StageTiming is how long one hot-path stage took per call over the
+// glove's last diagnostics window.
+type StageTiming struct {
+	MeanUs float64 `json:"mean_us"`
+	MaxUs  float64 `json:"max_us"`
+}
+
+// Diagnostics is the glove's own view of where time goes and what it lost
+// before anything reached the radio. Stages and jitter cover the last
+// window; counters run from boot.
+type Diagnostics struct {
+	UptimeMs       uint32                `json:"uptime_ms"`
+	WindowMs       uint16                `json:"window_ms"`
+	I2C            StageTiming           `json:"i2c"`     // One FIFO burst read
+	Convert        StageTiming           `json:"convert"` // Offsets, scaling and fusion for one read
+	Build          StageTiming           `json:"build"`   // One sample or batch into a frame
+	Notify         StageTiming           `json:"notify"`  // One setValue + notify
+	Jitter         [JitterBuckets]uint16 `json:"jitter"`
+	Dropped        uint32                `json:"dropped"` // Samples lost between acquisition and BLE
+	FIFOResets     uint32                `json:"fifo_resets"`
+	Late           uint32                `json:"late"` // Samples held up on the glove
+	NotifyFailures uint32                `json:"notify_failures"`
+	HeapFree       uint32                `json:"heap_free"`
+	HeapMin        uint32                `json:"heap_min"`
+}
+
+// ParseDiagnostics decodes the 80-byte diagnostics characteristic value.
+func ParseDiagnostics(data []byte) (Diagnostics, error) {
+	if len(data) != DiagnosticsSize {
+		return Diagnostics{}, fmt.Errorf("%w: diagnostics (%d bytes)", ErrInvalidFrame, len(data))
+	}
+	u32 := func(offset int) uint32 { return binary.LittleEndian.Uint32(data[offset : offset+4]) }
+
+	mhz := float64(binary.LittleEndian.Uint16(data[4:6]))
+	if mhz == 0 {
+		mhz = 1 // Not published yet: every stage reads 0 either way
+	}
+	stage := func(i int) StageTiming {
+		return StageTiming{
+			MeanUs: float64(u32(8+4*i)) / mhz,
+			MaxUs:  float64(u32(24+4*i)) / mhz,
+		}
+	}
+
+	d := Diagnostics{
+		UptimeMs:       u32(0),
+		WindowMs:       binary.LittleEndian.Uint16(data[6:8]),
+		I2C:            stage(0),
+		Convert:        stage(1),
+		Build:          stage(2),
+		Notify:         stage(3),
+		Dropped:        u32(56),
+		FIFOResets:     u32(60),
+		Late:           u32(64),
+		NotifyFailures: u32(68),
+		HeapFree:       u32(72),
+		HeapMin:        u32(76),
+	}
+	for i := range d.Jitter {
+		d.Jitter[i] = binary.LittleEndian.Uint16(data[40+2*i : 42+2*i])
+	}
+	return d, nil
+}
+
+// String returns a one-line summary of the on-glove figures.
+func (d Diagnostics) String() string {
+	return fmt.Sprintf("i2c %.0f/%.0fµs, notify %.0f/%.0fµs, dropped %d, FIFO resets %d, late %d, notify failures %d, heap low %dKB",
+		d.I2C.MeanUs, d.I2C.MaxUs, d.Notify.MeanUs, d.Notify.MaxUs,
+		d.Dropped, d.FIFOResets, d.Late, d.NotifyFailures, d.HeapMin/1024)
+}
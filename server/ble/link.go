@@ -0,0 +1,45 @@
+package ble
+
+import (
+	"encoding/binary"
+	"fmt"
+)
+
+// LinkStatusSize is the size of the status characteristic value
+// (see firmware/lib/FighterLink/src/link_status.h).
+const LinkStatusSize = 14
+
+// LinkStatus holds the connection parameters a glove reports as granted.
+type LinkStatus struct {
+	IntervalMs float64 `json:"interval_ms"`
+	Latency    uint16  `json:"latency"`
+	TimeoutMs  int     `json:"timeout_ms"`
+	MTU        uint16  `json:"mtu"`
+	TxOctets   uint16  `json:"tx_octets"` // LL payload, glove → central
+	RxOctets   uint16  `json:"rx_octets"`
+	TxPHY      uint8   `json:"tx_phy"` // 1 = 1M, 2 = 2M, 3 = Coded
+	RxPHY      uint8   `json:"rx_phy"`
+}
+
+// ParseLinkStatus decodes the 14-byte status characteristic value.
+func ParseLinkStatus(data []byte) (LinkStatus, error) {
+	if len(data) != LinkStatusSize {
+		return LinkStatus{}, fmt.Errorf("%w: link status (%d bytes)", ErrInvalidFrame, len(data))
+	}
+	return LinkStatus{
+		IntervalMs: float64(binary.LittleEndian.Uint16(data[0:2])) * 1.25,
+		Latency:    binary.LittleEndian.Uint16(data[2:4]),
+		TimeoutMs:  int(binary.LittleEndian.Uint16(data[4:6])) * 10,
+		MTU:        binary.LittleEndian.Uint16(data[6:8]),
+		TxOctets:   binary.LittleEndian.Uint16(data[8:10]),
+		RxOctets:   binary.LittleEndian.Uint16(data[10:12]),
+		TxPHY:      data[12],
+		RxPHY:      data[13],
+	}, nil
+}
+
+// String returns a human-readable representation of the link.
+func (s LinkStatus) String() string {
+	return fmt.Sprintf("%.2fms interval, latency %d, timeout %dms, MTU %d, DLE %d/%d, PHY %d/%d",
+		s.IntervalMs, s.Latency, s.TimeoutMs, s.MTU, s.TxOctets, s.RxOctets, s.TxPHY, s.RxPHY)
+}
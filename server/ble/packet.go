@@ -5,6 +5,7 @@ import (
 	"encoding/binary"
 	"errors"
 	"fmt"
+	"math"
 )
 
 // PacketSize is the expected size of a sensor packet in bytes.
@@ -19,21 +20,146 @@ type SensorPacket struct {
 	GyroX     int16  // Gyroscope X (raw value, divide by 10 for °/s)
 	GyroY     int16  // Gyroscope Y
 	GyroZ     int16  // Gyroscope Z
-	Timestamp uint32 // Milliseconds since boot
-	Sequence  uint16 // Packet sequence number
+	Timestamp uint32 // Glove clock: µs since boot (ms on firmware without clock sync)
+	Sequence  uint32 // Sample sequence number (extended by Central for 20-byte packets)
 	Battery   uint8  // Battery percentage (0-100)
 	Flags     uint8  // Status flags
+
+	// On-glove orientation filter output, set only for fused frames
+	Fused  bool     // Quat and LinAcc are valid
+	Quat   [4]int16 // Orientation w, x, y, z, sensor → world (divide by 16384)
+	LinAcc [3]int16 // Gravity-removed acceleration, sensor frame (divide by 100 for m/s²)
+
+	// Set only for v2 frames: the sample as the sensor read it, offset
+	// corrected. AccX..GyroZ then hold it truncated to packet units as the
+	// glove would have sent it; AccelMS2 and GyroDPS use the full resolution.
+	Raw   [6]int16    // accX..gyroZ in sensor LSB
+	Scale *FrameScale // Sensitivity Raw was read at
+
+	Time     int64 // Server clock, µs since the epoch (set by Central from Timestamp)
+	Received int64 // Server clock when its frame arrived, µs; 0 for replayed samples
+}
+
+// FrameScale is the scale descriptor of a v2 frame.
+type FrameScale struct {
+	AccelLSBPerG    uint16 // 16384 at ±2g
+	GyroLSBPer10DPS uint16 // LSB per 10 °/s: 1310 at ±250°/s
 }
 
+// Fixed-point scales of the int16 sensor fields (ACCEL_SCALE / GYRO_SCALE in firmware).
+const (
+	AccelScale = 100   // m/s² × 100
+	GyroScale  = 10    // °/s × 10
+	QuatScale  = 16384 // Q14 quaternion components
+	GravityMS2 = 9.81  // m/s² per g, as on the glove (GRAVITY_MS2)
+)
+
 // Flag bit positions
 const (
 	FlagCharging   uint8 = 1 << 0 // Bit 0: Is charging
 	FlagCalibrated uint8 = 1 << 1 // Bit 1: Calibration complete
+	FlagIdle       uint8 = 1 << 2 // Bit 2: Glove is still and streaming its idle tier
 )
 
 // ErrInvalidPacketSize is returned when the packet data is not 20 bytes.
 var ErrInvalidPacketSize = errors.New("invalid packet size: expected 20 bytes")
 
+// Batched frame layout (see BatchHeader in firmware/lib/FighterLink/src/sensor_packet.h).
+const (
+	FrameTypeBatch      uint8 = 0xB1 // BatchHeader + SampleRecord[]
+	FrameTypeDelta      uint8 = 0xB2 // BatchHeader + keyframe + zigzag varint deltas
+	FrameTypeFused      uint8 = 0xB3 // BatchHeader + (SampleRecord + FusionRecord)[]
+	FrameTypeFusedDelta uint8 = 0xB4 // As FrameTypeDelta, over fused records
+	BatchHeaderSize           = 14
+	SampleRecordSize          = 12
+	FusedRecordSize           = 26 // SampleRecord + 14-byte FusionRecord
+
+	// Version 2 frames (FrameHeaderV2): a scale descriptor, then any of the
+	// batched frames above with SampleRecord fields in sensor LSB
+	FrameTypeV2       uint8 = 0xB5
+	FrameVersion2     uint8 = 2
+	FrameHeaderV2Size       = 6
+)
+
+// Punch event record layouts (see PunchEventPacket and PunchFeaturePacket
+// in sensor_packet.h).
+const (
+	FrameTypePunch         uint8 = 0xC1
+	FrameTypePunchFeatures uint8 = 0xC2 // Punch with features from the window around it
+	PunchRecordSize              = 14
+	PunchFeatureRecordSize       = 24
+)
+
+// Latency trace frame layout (see LatencyTraceFrame in sensor_packet.h).
+const (
+	FrameTypeLatency      uint8 = 0xD1
+	LatencyTraceFrameSize       = 9
+)
+
+// Punch types reported by on-glove detection.
+const (
+	PunchTypeNone     uint8 = 0 // Heartbeat, no punch
+	PunchTypeStraight uint8 = 1
+	PunchTypeHook     uint8 = 2
+	PunchTypeUppercut uint8 = 3
+	PunchTypeUnknown  uint8 = 4
+)
+
+// PunchRecord is a punch detected on the glove (event-only streaming mode).
+type PunchRecord struct {
+	Type         uint8  // PunchType* constant
+	Count        uint16 // Punch number since glove boot
+	PeakForce    uint16 // Gravity-compensated peak, divide by 100 for m/s²
+	PeakRotation uint16 // Peak |gyroZ|, divide by 10 for °/s
+	Timestamp    uint32 // Glove clock at the threshold crossing (as SensorPacket)
+	Battery      uint8  // Battery percentage (0-100)
+	Flags        uint8  // Status flags
+
+	Time     int64 // Server clock, µs since the epoch (set by Central from Timestamp)
+	Received int64 // Server clock when the record arrived, µs
+
+	// Set for FrameTypePunchFeatures records; PeakForce and PeakRotation
+	// then come from the same window
+	Features *PunchFeatures
+}
+
+// PunchFeatures is what the glove reduced from the full-rate samples
+// around one punch.
+type PunchFeatures struct {
+	Impulse    uint16   // |linear accel| over the impact, divide by 100 for m/s
+	PeakGyro   [3]int16 // Signed peak per axis, divide by 10 for °/s
+	Duration   uint16   // Impact above the glove's threshold, divide by 10 for ms
+	Retraction uint16   // Peak to strongest pull-back, divide by 10 for ms
+}
+
+// ImpulseMS returns the integrated linear acceleration in m/s.
+func (f *PunchFeatures) ImpulseMS() float64 {
+	return float64(f.Impulse) / 100
+}
+
+// PeakGyroDPS returns the signed peak rotation rate per axis in °/s.
+func (f *PunchFeatures) PeakGyroDPS() [3]float64 {
+	return [3]float64{
+		float64(f.PeakGyro[0]) / GyroScale,
+		float64(f.PeakGyro[1]) / GyroScale,
+		float64(f.PeakGyro[2]) / GyroScale,
+	}
+}
+
+// DurationMs returns the impact duration in milliseconds.
+func (f *PunchFeatures) DurationMs() float64 {
+	return float64(f.Duration) / 10
+}
+
+// RetractionMs returns the time from peak to pull-back in milliseconds.
+func (f *PunchFeatures) RetractionMs() float64 {
+	return float64(f.Retraction) / 10
+}
+
+// ErrInvalidFrame is returned when a notification is neither a legacy
+// SensorPacket nor a well-formed batched frame.
+var ErrInvalidFrame = errors.New("invalid frame")
+
 // ParsePacket decodes a 20-byte binary packet into a SensorPacket struct.
 func ParsePacket(data []byte) (*SensorPacket, error) {
 	if len(data) != PacketSize {
@@ -48,7 +174,7 @@ func ParsePacket(data []byte) (*SensorPacket, error) {
 		GyroY:     int16(binary.LittleEndian.Uint16(data[8:10])),
 		GyroZ:     int16(binary.LittleEndian.Uint16(data[10:12])),
 		Timestamp: binary.LittleEndian.Uint32(data[12:16]),
-		Sequence:  binary.LittleEndian.Uint16(data[16:18]),
+		Sequence:  uint32(binary.LittleEndian.Uint16(data[16:18])), // Low 16 bits, see Central
 		Battery:   data[18],
 		Flags:     data[19],
 	}
@@ -56,18 +182,350 @@ func ParsePacket(data []byte) (*SensorPacket, error) {
 	return p, nil
 }
 
+// IsPunchFrame reports whether a notification carries a PunchRecord
+// rather than sensor samples.
+func IsPunchFrame(data []byte) bool {
+	switch len(data) {
+	case PunchRecordSize:
+		return data[0] == FrameTypePunch
+	case PunchFeatureRecordSize:
+		return data[0] == FrameTypePunchFeatures
+	}
+	return false
+}
+
+// LatencyTrace is the path of one frame the glove traced, every stamp on
+// the server clock in µs since the epoch. Captured and Queued come from
+// the glove's clock, so the link stage is only as good as clock sync.
+type LatencyTrace struct {
+	Captured int64 // Oldest sample (or punch crossing) in the frame captured
+	Queued   int64 // Frame handed to the glove's BLE stack
+	Received int64 // Frame arrived
+}
+
+// IsLatencyFrame reports whether a notification is a latency trace frame
+// rather than sensor samples or a punch.
+func IsLatencyFrame(data []byte) bool {
+	return len(data) == LatencyTraceFrameSize && data[0] == FrameTypeLatency
+}
+
+// ParseLatencyFrame decodes a 9-byte latency trace frame into the glove
+// clock stamps of the frame before it: capture and queued time.
+func ParseLatencyFrame(data []byte) (captured, queued uint32, err error) {
+	if !IsLatencyFrame(data) {
+		return 0, 0, fmt.Errorf("%w: not a latency trace (%d bytes)", ErrInvalidFrame, len(data))
+	}
+	return binary.LittleEndian.Uint32(data[1:5]), binary.LittleEndian.Uint32(data[5:9]), nil
+}
+
+// ParsePunchRecord decodes a 14-byte punch event record or a 24-byte punch
+// feature record.
+func ParsePunchRecord(data []byte) (*PunchRecord, error) {
+	if !IsPunchFrame(data) {
+		return nil, fmt.Errorf("%w: not a punch record (%d bytes)", ErrInvalidFrame, len(data))
+	}
+	if data[0] == FrameTypePunchFeatures {
+		return parsePunchFeatures(data), nil
+	}
+
+	return &PunchRecord{
+		Type:         data[1],
+		Count:        binary.LittleEndian.Uint16(data[2:4]),
+		PeakForce:    binary.LittleEndian.Uint16(data[4:6]),
+		PeakRotation: binary.LittleEndian.Uint16(data[6:8]),
+		Timestamp:    binary.LittleEndian.Uint32(data[8:12]),
+		Battery:      data[12],
+		Flags:        data[13],
+	}, nil
+}
+
+func parsePunchFeatures(data []byte) *PunchRecord {
+	u16 := func(offset int) uint16 { return binary.LittleEndian.Uint16(data[offset : offset+2]) }
+
+	f := &PunchFeatures{
+		Impulse:    u16(10),
+		PeakGyro:   [3]int16{int16(u16(12)), int16(u16(14)), int16(u16(16))},
+		Duration:   u16(18),
+		Retraction: u16(20),
+	}
+	rotation := int32(f.PeakGyro[2])
+	if rotation < 0 {
+		rotation = -rotation
+	}
+	return &PunchRecord{
+		Type:         data[1],
+		Count:        u16(2),
+		Timestamp:    binary.LittleEndian.Uint32(data[4:8]),
+		PeakForce:    u16(8),
+		PeakRotation: uint16(rotation),
+		Battery:      data[22],
+		Flags:        data[23],
+		Features:     f,
+	}
+}
+
+// IsHeartbeat returns true if the record carries no punch.
+func (r *PunchRecord) IsHeartbeat() bool {
+	return r.Type == PunchTypeNone
+}
+
+// ForceMS2 returns the peak force in m/s².
+func (r *PunchRecord) ForceMS2() float64 {
+	return float64(r.PeakForce) / AccelScale
+}
+
+// RotationDPS returns the peak rotation in degrees per second.
+func (r *PunchRecord) RotationDPS() float64 {
+	return float64(r.PeakRotation) / GyroScale
+}
+
+// IsCalibrated returns true if the glove has completed calibration.
+func (r *PunchRecord) IsCalibrated() bool {
+	return r.Flags&FlagCalibrated != 0
+}
+
+// IsIdle returns true if the glove was in its idle rate tier.
+func (r *PunchRecord) IsIdle() bool {
+	return r.Flags&FlagIdle != 0
+}
+
+// ParseFrame decodes one BLE notification into its samples, oldest first.
+// A 20-byte payload is a single legacy SensorPacket; anything else must be a
+// batched frame, which is unpacked into one SensorPacket per record, either
+// bare (v1, packet units) or behind a FrameHeaderV2 (sensor LSB).
+func ParseFrame(data []byte) ([]*SensorPacket, error) {
+	if len(data) == PacketSize {
+		p, err := ParsePacket(data)
+		if err != nil {
+			return nil, err
+		}
+		return []*SensorPacket{p}, nil
+	}
+
+	if len(data) > 0 && data[0] == FrameTypeV2 {
+		return parseFrameV2(data)
+	}
+	return parseBatchFrame(data)
+}
+
+// parseFrameV2 unpacks a versioned frame: the version decides the layout
+// behind the frame type.
+func parseFrameV2(data []byte) ([]*SensorPacket, error) {
+	if len(data) < FrameHeaderV2Size {
+		return nil, fmt.Errorf("%w: v2 frame of %d bytes", ErrInvalidFrame, len(data))
+	}
+	if data[1] != FrameVersion2 {
+		return nil, fmt.Errorf("%w: unsupported frame version %d", ErrInvalidFrame, data[1])
+	}
+	scale := &FrameScale{
+		AccelLSBPerG:    binary.LittleEndian.Uint16(data[2:4]),
+		GyroLSBPer10DPS: binary.LittleEndian.Uint16(data[4:6]),
+	}
+	if scale.AccelLSBPerG == 0 || scale.GyroLSBPer10DPS == 0 {
+		return nil, fmt.Errorf("%w: v2 frame without a scale", ErrInvalidFrame)
+	}
+
+	packets, err := parseBatchFrame(data[FrameHeaderV2Size:])
+	if err != nil {
+		return nil, err
+	}
+	for _, p := range packets {
+		p.setRaw(scale)
+	}
+	return packets, nil
+}
+
+// setRaw moves the LSB a v2 record carries into Raw and puts packet units
+// in their place.
+func (p *SensorPacket) setRaw(scale *FrameScale) {
+	p.Raw = [6]int16{p.AccX, p.AccY, p.AccZ, p.GyroX, p.GyroY, p.GyroZ}
+	p.Scale = scale
+	accel := GravityMS2 * AccelScale / float64(scale.AccelLSBPerG)
+	gyro := 10 * GyroScale / float64(scale.GyroLSBPer10DPS)
+	p.AccX = toPacketUnits(p.Raw[0], accel)
+	p.AccY = toPacketUnits(p.Raw[1], accel)
+	p.AccZ = toPacketUnits(p.Raw[2], accel)
+	p.GyroX = toPacketUnits(p.Raw[3], gyro)
+	p.GyroY = toPacketUnits(p.Raw[4], gyro)
+	p.GyroZ = toPacketUnits(p.Raw[5], gyro)
+}
+
+// toPacketUnits truncates like the glove's conversion, clamped to int16.
+func toPacketUnits(lsb int16, unitsPerLSB float64) int16 {
+	v := math.Trunc(float64(lsb) * unitsPerLSB)
+	return int16(math.Max(math.MinInt16, math.Min(math.MaxInt16, v)))
+}
+
+// parseBatchFrame unpacks any v1 batched frame.
+func parseBatchFrame(data []byte) ([]*SensorPacket, error) {
+	if len(data) < BatchHeaderSize {
+		return nil, fmt.Errorf("%w: %d bytes", ErrInvalidFrame, len(data))
+	}
+
+	switch data[0] {
+	case FrameTypeBatch:
+		return parseBatch(data, SampleRecordSize)
+	case FrameTypeDelta:
+		return parseDeltaBatch(data, SampleRecordSize)
+	case FrameTypeFused:
+		return parseBatch(data, FusedRecordSize)
+	case FrameTypeFusedDelta:
+		return parseDeltaBatch(data, FusedRecordSize)
+	default:
+		return nil, fmt.Errorf("%w: unknown frame type 0x%02x", ErrInvalidFrame, data[0])
+	}
+}
+
+// batchHeader holds the fields shared by every batched frame type.
+type batchHeader struct {
+	count     int
+	sequence  uint32
+	timestamp uint32
+	interval  uint32 // µs between records
+	battery   uint8
+	flags     uint8
+}
+
+func parseBatchHeader(data []byte) batchHeader {
+	return batchHeader{
+		count:     int(data[1]),
+		sequence:  binary.LittleEndian.Uint32(data[2:6]),
+		timestamp: binary.LittleEndian.Uint32(data[6:10]),
+		interval:  uint32(binary.LittleEndian.Uint16(data[10:12])),
+		battery:   data[12],
+		flags:     data[13],
+	}
+}
+
+// packet builds the SensorPacket for record i of the batch from its
+// 6 (SampleRecord) or 13 (fused record) fields.
+func (h batchHeader) packet(i int, axes []int16) *SensorPacket {
+	p := &SensorPacket{
+		AccX:      axes[0],
+		AccY:      axes[1],
+		AccZ:      axes[2],
+		GyroX:     axes[3],
+		GyroY:     axes[4],
+		GyroZ:     axes[5],
+		Timestamp: h.timestamp + uint32(i)*h.interval,
+		Sequence:  h.sequence + uint32(i),
+		Battery:   h.battery,
+		Flags:     h.flags,
+	}
+	if len(axes) == FusedRecordSize/2 {
+		p.Fused = true
+		copy(p.Quat[:], axes[6:10])
+		copy(p.LinAcc[:], axes[10:13])
+	}
+	return p
+}
+
+// readRecord decodes one raw record into axes (one int16 per field).
+func readRecord(r []byte, axes []int16) {
+	for j := range axes {
+		axes[j] = int16(binary.LittleEndian.Uint16(r[j*2:]))
+	}
+}
+
+// parseBatch unpacks a BatchHeader + raw record frame.
+func parseBatch(data []byte, recordSize int) ([]*SensorPacket, error) {
+	h := parseBatchHeader(data)
+	if want := BatchHeaderSize + h.count*recordSize; len(data) != want {
+		return nil, fmt.Errorf("%w: batch of %d needs %d bytes, got %d", ErrInvalidFrame, h.count, want, len(data))
+	}
+
+	packets := make([]*SensorPacket, h.count)
+	axes := make([]int16, recordSize/2)
+	for i := range packets {
+		readRecord(data[BatchHeaderSize+i*recordSize:], axes)
+		packets[i] = h.packet(i, axes)
+	}
+
+	return packets, nil
+}
+
+// parseDeltaBatch unpacks a keyframe + zigzag varint delta frame.
+func parseDeltaBatch(data []byte, recordSize int) ([]*SensorPacket, error) {
+	h := parseBatchHeader(data)
+	if h.count == 0 {
+		if len(data) != BatchHeaderSize {
+			return nil, fmt.Errorf("%w: empty delta batch with %d trailing bytes", ErrInvalidFrame, len(data)-BatchHeaderSize)
+		}
+		return nil, nil
+	}
+	if len(data) < BatchHeaderSize+recordSize {
+		return nil, fmt.Errorf("%w: delta batch too short for keyframe (%d bytes)", ErrInvalidFrame, len(data))
+	}
+
+	packets := make([]*SensorPacket, h.count)
+	axes := make([]int16, recordSize/2)
+	readRecord(data[BatchHeaderSize:], axes)
+	packets[0] = h.packet(0, axes)
+
+	rest := data[BatchHeaderSize+recordSize:]
+	for i := 1; i < h.count; i++ {
+		for j := range axes {
+			zz, n := binary.Uvarint(rest)
+			if n <= 0 {
+				return nil, fmt.Errorf("%w: truncated delta in record %d", ErrInvalidFrame, i)
+			}
+			rest = rest[n:]
+			delta := int32(zz>>1) ^ -int32(zz&1)
+			axes[j] = int16(int32(axes[j]) + delta)
+		}
+		packets[i] = h.packet(i, axes)
+	}
+
+	if len(rest) != 0 {
+		return nil, fmt.Errorf("%w: %d trailing bytes after delta batch", ErrInvalidFrame, len(rest))
+	}
+
+	return packets, nil
+}
+
 // AccelMS2 returns accelerometer values in m/s².
 func (p *SensorPacket) AccelMS2() (x, y, z float64) {
-	return float64(p.AccX) / 100.0,
-		float64(p.AccY) / 100.0,
-		float64(p.AccZ) / 100.0
+	if p.Scale != nil {
+		k := GravityMS2 / float64(p.Scale.AccelLSBPerG)
+		return float64(p.Raw[0]) * k, float64(p.Raw[1]) * k, float64(p.Raw[2]) * k
+	}
+	return float64(p.AccX) / AccelScale,
+		float64(p.AccY) / AccelScale,
+		float64(p.AccZ) / AccelScale
 }
 
 // GyroDPS returns gyroscope values in degrees per second.
 func (p *SensorPacket) GyroDPS() (x, y, z float64) {
-	return float64(p.GyroX) / 10.0,
-		float64(p.GyroY) / 10.0,
-		float64(p.GyroZ) / 10.0
+	if p.Scale != nil {
+		k := 10 / float64(p.Scale.GyroLSBPer10DPS)
+		return float64(p.Raw[3]) * k, float64(p.Raw[4]) * k, float64(p.Raw[5]) * k
+	}
+	return float64(p.GyroX) / GyroScale,
+		float64(p.GyroY) / GyroScale,
+		float64(p.GyroZ) / GyroScale
+}
+
+// LinearAccelMS2 returns the glove's gravity-removed acceleration in m/s²
+// (fused packets only).
+func (p *SensorPacket) LinearAccelMS2() (x, y, z float64) {
+	return float64(p.LinAcc[0]) / AccelScale,
+		float64(p.LinAcc[1]) / AccelScale,
+		float64(p.LinAcc[2]) / AccelScale
+}
+
+// UpVector returns world up in the sensor frame, as a unit vector, from the
+// glove's orientation (fused packets only). It points the way gravity reads
+// on a still glove.
+func (p *SensorPacket) UpVector() [3]float64 {
+	w := float64(p.Quat[0]) / QuatScale
+	x := float64(p.Quat[1]) / QuatScale
+	y := float64(p.Quat[2]) / QuatScale
+	z := float64(p.Quat[3]) / QuatScale
+	return [3]float64{
+		2 * (x*z - w*y),
+		2 * (w*x + y*z),
+		w*w - x*x - y*y + z*z,
+	}
 }
 
 // IsCharging returns true if the glove is currently charging.
@@ -80,6 +538,12 @@ func (p *SensorPacket) IsCalibrated() bool {
 	return p.Flags&FlagCalibrated != 0
 }
 
+// IsIdle returns true if the glove sent this sample in its idle rate tier:
+// still, one sample every ADAPTIVE_IDLE_PERIOD_MS instead of the full rate.
+func (p *SensorPacket) IsIdle() bool {
+	return p.Flags&FlagIdle != 0
+}
+
 // String returns a human-readable representation of the packet.
 func (p *SensorPacket) String() string {
 	ax, ay, az := p.AccelMS2()
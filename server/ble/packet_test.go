@@ -0,0 +1,220 @@
+package ble
+
+import (
+	"encoding/hex"
+	"errors"
+	"testing"
+)
+
+// Golden frames from the firmware's SampleBatcher (sample_batcher.cpp) and a
+// PunchFeaturePacket as sendPunchFeatures fills it, built on the host from
+// goldenSamples and goldenFusion: sequence 65534 on, first timestamp
+// 4294967000 µs, 1000 µs apart, battery 87, flags 0x03.
+const (
+	goldenRaw        = "b104feff0000d8feffffe8035703ff7f008000000100ffffd5030080ff7f00000200fdffd903ff7f00806400d4fe4000c0ff000000009cffff7f00800000"
+	goldenDelta      = "b204feff0000d8feffffe8035703ff7f008000000100ffffd503fdff07feff0700020308feff07fdff07c801db048601b110fdff038080048f03d68404ff80048001"
+	goldenFused      = "b302feff0000d8feffffe8035703ff7f008000000100ffffd50300400000000000000c00deff38000080ff7f00000200fdffd90300c0412dbfd201000080ff7f0000"
+	goldenFusedDelta = "b402feff0000d8feffffe8035703ff7f008000000100ffffd50300400000000000000c00deff3800fdff07feff0700020308ffff0382b50181b50102978004c280046f"
+	goldenV2Delta    = "b50200401e05" + goldenDelta
+	goldenEmptyDelta = "b2000000000000000000e8035703"
+	goldenFeatures   = "c202010215cd5b07e110fa0078000080d8dca401dc054006"
+)
+
+var goldenSamples = [][6]int16{
+	{32767, -32768, 0, 1, -1, 981},
+	{-32768, 32767, 0, 2, -3, 985},
+	{32767, -32768, 100, -300, 64, -64},
+	{0, 0, -100, 32767, -32768, 0},
+}
+
+var goldenFusion = [][7]int16{
+	{16384, 0, 0, 0, 12, -34, 56},
+	{-16384, 11585, -11585, 1, -32768, 32767, 0},
+}
+
+func mustHex(t *testing.T, s string) []byte {
+	t.Helper()
+	data, err := hex.DecodeString(s)
+	if err != nil {
+		t.Fatal(err)
+	}
+	return data
+}
+
+func checkBatch(t *testing.T, packets []*SensorPacket, count int, fused bool) {
+	t.Helper()
+	if len(packets) != count {
+		t.Fatalf("got %d packets, want %d", len(packets), count)
+	}
+	for i, p := range packets {
+		axes := [6]int16{p.AccX, p.AccY, p.AccZ, p.GyroX, p.GyroY, p.GyroZ}
+		if p.Raw != [6]int16{} {
+			axes = p.Raw
+		}
+		if axes != goldenSamples[i] {
+			t.Errorf("record %d: axes %v, want %v", i, axes, goldenSamples[i])
+		}
+		if want := uint32(65534 + i); p.Sequence != want {
+			t.Errorf("record %d: sequence %d, want %d", i, p.Sequence, want)
+		}
+		if want := uint32(4294967000) + uint32(i)*1000; p.Timestamp != want {
+			t.Errorf("record %d: timestamp %d, want %d", i, p.Timestamp, want)
+		}
+		if p.Battery != 87 || p.Flags != 0x03 {
+			t.Errorf("record %d: battery %d flags 0x%02x", i, p.Battery, p.Flags)
+		}
+		if p.Fused != fused {
+			t.Errorf("record %d: fused %v, want %v", i, p.Fused, fused)
+		}
+		if fused {
+			f := goldenFusion[i]
+			if p.Quat != [4]int16{f[0], f[1], f[2], f[3]} || p.LinAcc != [3]int16{f[4], f[5], f[6]} {
+				t.Errorf("record %d: quat %v linacc %v, want %v", i, p.Quat, p.LinAcc, f)
+			}
+		}
+	}
+}
+
+func TestPacketParsing(t *testing.T) {
+	data := []byte{
+		0xd5, 0x03, 0x9c, 0xff, 0x00, 0x80, // 981, -100, -32768
+		0xff, 0x7f, 0x01, 0x00, 0xff, 0xff, // 32767, 1, -1
+		0x15, 0xcd, 0x5b, 0x07, // 123456789
+		0x34, 0x12, // Sequence low 16 bits
+		0x64, 0x02,
+	}
+	p, err := ParsePacket(data)
+	if err != nil {
+		t.Fatal(err)
+	}
+	want := SensorPacket{AccX: 981, AccY: -100, AccZ: -32768, GyroX: 32767, GyroY: 1, GyroZ: -1,
+		Timestamp: 123456789, Sequence: 0x1234, Battery: 100, Flags: FlagCalibrated}
+	if *p != want {
+		t.Errorf("got %+v, want %+v", *p, want)
+	}
+
+	if _, err := ParsePacket(data[:19]); !errors.Is(err, ErrInvalidPacketSize) {
+		t.Errorf("19 bytes: err %v, want ErrInvalidPacketSize", err)
+	}
+}
+
+func TestParseFrameGolden(t *testing.T) {
+	tests := []struct {
+		name  string
+		frame string
+		count int
+		fused bool
+	}{
+		{"raw", goldenRaw, 4, false},
+		{"delta", goldenDelta, 4, false},
+		{"fused", goldenFused, 2, true},
+		{"fused delta", goldenFusedDelta, 2, true},
+		{"v2 delta", goldenV2Delta, 4, false},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			packets, err := ParseFrame(mustHex(t, tt.frame))
+			if err != nil {
+				t.Fatal(err)
+			}
+			checkBatch(t, packets, tt.count, tt.fused)
+		})
+	}
+}
+
+func TestParseFrameEmptyDelta(t *testing.T) {
+	packets, err := ParseFrame(mustHex(t, goldenEmptyDelta))
+	if err != nil || len(packets) != 0 {
+		t.Fatalf("got %d packets, err %v", len(packets), err)
+	}
+	if _, err := ParseFrame(append(mustHex(t, goldenEmptyDelta), 0)); !errors.Is(err, ErrInvalidFrame) {
+		t.Errorf("trailing byte: err %v, want ErrInvalidFrame", err)
+	}
+}
+
+func TestParseFrameV2Units(t *testing.T) {
+	packets, err := ParseFrame(mustHex(t, goldenV2Delta))
+	if err != nil {
+		t.Fatal(err)
+	}
+	if s := packets[0].Scale; s == nil || s.AccelLSBPerG != 16384 || s.GyroLSBPer10DPS != 1310 {
+		t.Fatalf("scale %+v", s)
+	}
+	// Truncated toward zero like the glove: ±32767 LSB × 981/16384 m/s² × 100,
+	// then 981 and ±32767 LSB × 100/1310 °/s × 10
+	if p := packets[0]; p.AccX != 1961 || p.AccY != -1962 || p.GyroZ != 74 {
+		t.Errorf("record 0: acc %d %d gyroZ %d", p.AccX, p.AccY, p.GyroZ)
+	}
+	if p := packets[3]; p.GyroX != 2501 || p.GyroY != -2501 {
+		t.Errorf("record 3: gyro %d %d", p.GyroX, p.GyroY)
+	}
+}
+
+func TestParseFrameRejects(t *testing.T) {
+	delta := mustHex(t, goldenDelta)
+	zeroScale := mustHex(t, goldenV2Delta)
+	zeroScale[2], zeroScale[3] = 0, 0
+	zeroGyro := mustHex(t, goldenV2Delta)
+	zeroGyro[4], zeroGyro[5] = 0, 0
+	badVersion := mustHex(t, goldenV2Delta)
+	badVersion[1] = 3
+	unknown := mustHex(t, goldenRaw)
+	unknown[0] = 0xBF
+	// Last varint cut after its continuation byte
+	truncated := delta[:len(delta)-1]
+
+	tests := []struct {
+		name  string
+		frame []byte
+	}{
+		{"truncated varint", truncated},
+		{"delta trailing byte", append(append([]byte{}, delta...), 0)},
+		{"raw trailing byte", append(mustHex(t, goldenRaw), 0)},
+		{"raw short record", mustHex(t, goldenRaw)[:61]},
+		{"fused delta keyframe only", mustHex(t, goldenFusedDelta)[:BatchHeaderSize+FusedRecordSize]},
+		{"delta short keyframe", delta[:BatchHeaderSize+SampleRecordSize-1]},
+		{"short header", delta[:BatchHeaderSize-1]},
+		{"v2 zero accel scale", zeroScale},
+		{"v2 zero gyro scale", zeroGyro},
+		{"v2 version", badVersion},
+		{"v2 short header", zeroScale[:FrameHeaderV2Size-1]},
+		{"unknown type", unknown},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			if _, err := ParseFrame(tt.frame); !errors.Is(err, ErrInvalidFrame) {
+				t.Errorf("err %v, want ErrInvalidFrame", err)
+			}
+		})
+	}
+}
+
+func TestParsePunchFeatures(t *testing.T) {
+	data := mustHex(t, goldenFeatures)
+	if !IsPunchFrame(data) {
+		t.Fatal("not a punch frame")
+	}
+	r, err := ParsePunchRecord(data)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if r.Type != PunchTypeHook || r.Count != 513 || r.Timestamp != 123456789 || r.PeakForce != 4321 ||
+		r.Battery != 64 || r.Flags != 0x06 {
+		t.Errorf("record %+v", *r)
+	}
+	// |peakGyroZ|, as the 14-byte record carries it
+	if r.PeakRotation != 9000 {
+		t.Errorf("peak rotation %d, want 9000", r.PeakRotation)
+	}
+	want := PunchFeatures{Impulse: 250, PeakGyro: [3]int16{120, -32768, -9000}, Duration: 420, Retraction: 1500}
+	if r.Features == nil || *r.Features != want {
+		t.Errorf("features %+v, want %+v", r.Features, want)
+	}
+	if r.Features.ImpulseMS() != 2.5 || r.Features.DurationMs() != 42 || r.Features.RetractionMs() != 150 {
+		t.Errorf("impulse %v duration %v retraction %v", r.Features.ImpulseMS(), r.Features.DurationMs(), r.Features.RetractionMs())
+	}
+
+	if _, err := ParsePunchRecord(data[:PunchRecordSize]); !errors.Is(err, ErrInvalidFrame) {
+		t.Errorf("14-byte 0xC2: err %v, want ErrInvalidFrame", err)
+	}
+}
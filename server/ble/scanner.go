@@ -2,9 +2,13 @@
 package ble
 
 import (
+	"fmt"
 	"log"
+	"sort"
 	"sync"
 	"time"
+
+	"tinygo.org/x/bluetooth"
 )
 
 // ScanConfig holds configuration for device scanning.
@@ -36,6 +40,9 @@ type Scanner struct {
 	running bool
 	stop    chan struct{}
 	scanMu  sync.Mutex // Prevents concurrent scan attempts
+
+	broadcastMu sync.Mutex
+	gloves      map[GloveID]*BroadcastGlove // Broadcasting gloves heard so far
 }
 
 // NewScanner creates a new Scanner with the given Central and config.
@@ -171,3 +178,210 @@ func (s *Scanner) WaitForAnyGlove(timeout time.Duration) bool {
 		time.Sleep(100 * time.Millisecond)
 	}
 }
+
+// ─── Broadcast Mode ──────────────────────────────────────────────────────────
+
+// Manufacturer data of a glove built with BROADCAST_ENABLED (see
+// BroadcastHeader in firmware/lib/FighterLink/src/sensor_packet.h). The AD
+// value starts after the company ID: version, athlete, hand, counter, then
+// the frame the glove would have notified.
+const (
+	BroadcastCompanyID  uint16 = 0xFFFF
+	BroadcastVersion    byte   = 1
+	broadcastHeaderSize        = 4
+)
+
+// BroadcastTimeout is how long a broadcasting glove may go unheard before
+// it counts as gone. The next frame starts a new stream: it has usually
+// slept and rebooted in between.
+const BroadcastTimeout = 5 * time.Second
+
+// GloveID names a broadcasting glove by the athlete it was built for and
+// its hand.
+type GloveID struct {
+	Athlete uint8 `json:"athlete"`
+	Hand    Hand  `json:"hand"`
+}
+
+func (id GloveID) String() string {
+	return fmt.Sprintf("athlete %d %s", id.Athlete, id.Hand)
+}
+
+// BroadcastGlove is what the receiver knows about one broadcasting glove.
+type BroadcastGlove struct {
+	ID         GloveID   `json:"id"`
+	Address    string    `json:"address"`
+	RSSI       int16     `json:"rssi"`
+	LastSeen   time.Time `json:"last_seen"`
+	Frames     uint64    `json:"frames"`      // Distinct frames received
+	PacketLoss float64   `json:"packet_loss"` // Samples missing from the sequence, %
+
+	clock          *Clock
+	counter        uint8
+	seq            sequenceTracker
+	lastPunchCount uint16
+}
+
+// BroadcastPacketHandler receives each sample a broadcasting glove sends.
+type BroadcastPacketHandler func(id GloveID, packet *SensorPacket)
+
+// BroadcastPunchHandler receives each punch event or heartbeat.
+type BroadcastPunchHandler func(id GloveID, record *PunchRecord)
+
+// StartBroadcast listens for broadcasting gloves instead of connecting to
+// FighterLink_L and FighterLink_R: one continuous scan takes every frame
+// out of the advertising data, from any number of gloves at once. Nothing
+// is written back, so there is no clock sync or resend; samples are placed
+// by arrival and gaps only count as loss.
+func (s *Scanner) StartBroadcast(onPacket BroadcastPacketHandler, onPunch BroadcastPunchHandler) {
+	if s.running {
+		return
+	}
+	s.running = true
+	s.stop = make(chan struct{})
+	s.gloves = make(map[GloveID]*BroadcastGlove)
+
+	c := s.central
+	c.adapter.StopScan()
+	c.mu.Lock()
+	c.scanning = true // Stop ends it through StopScanning
+	c.mu.Unlock()
+
+	log.Println("Scanner: Listening for broadcasting gloves...")
+	go func() {
+		err := c.adapter.Scan(func(adapter *bluetooth.Adapter, result bluetooth.ScanResult) {
+			data, ok := result.ManufacturerData()[BroadcastCompanyID]
+			if !ok {
+				return
+			}
+			s.handleBroadcast(result, data, onPacket, onPunch)
+		})
+		if err != nil {
+			log.Printf("Scanner: Broadcast scan failed: %v", err)
+		}
+	}()
+}
+
+// handleBroadcast processes one advertisement from a broadcasting glove.
+// BlueZ reports the same one again whenever its RSSI changes; the frame
+// counter drops those.
+func (s *Scanner) handleBroadcast(result bluetooth.ScanResult, data []byte,
+	onPacket BroadcastPacketHandler, onPunch BroadcastPunchHandler) {
+	if len(data) < broadcastHeaderSize || data[0] != BroadcastVersion {
+		return
+	}
+	id := GloveID{Athlete: data[1], Hand: Hand(data[2])}
+	counter := data[3]
+	frame := data[broadcastHeaderSize:]
+	now := time.Now()
+
+	s.broadcastMu.Lock()
+	glove := s.gloves[id]
+	// A header without a frame means the glove has just (re)started advertising
+	fresh := glove == nil || now.Sub(glove.LastSeen) > BroadcastTimeout ||
+		(len(frame) == 0 && glove.Frames > 0)
+	if fresh {
+		log.Printf("Scanner: Hearing %s at %s", id, result.Address.String())
+		glove = &BroadcastGlove{ID: id, clock: NewClock(time.Microsecond)}
+		s.gloves[id] = glove
+	} else if counter == glove.counter {
+		glove.RSSI = result.RSSI
+		glove.LastSeen = now
+		s.broadcastMu.Unlock()
+		return
+	}
+	glove.Address = result.Address.String()
+	glove.RSSI = result.RSSI
+	glove.LastSeen = now
+	glove.counter = counter
+	if len(frame) == 0 {
+		s.broadcastMu.Unlock()
+		return
+	}
+	glove.Frames++
+
+	var packets []*SensorPacket
+	var record *PunchRecord
+	var err error
+	if IsPunchFrame(frame) {
+		record, err = ParsePunchRecord(frame)
+		if err == nil {
+			// Heartbeats repeat the latest count, punches advance it by one
+			expected := glove.lastPunchCount
+			if !record.IsHeartbeat() {
+				expected++
+			}
+			if glove.lastPunchCount > 0 && record.Count > expected {
+				log.Printf("Scanner: %s lost %d punch event(s)", id, record.Count-expected)
+			}
+			glove.lastPunchCount = record.Count
+		}
+	} else if packets, err = ParseFrame(frame); err == nil {
+		// A 20-byte packet only carries the low 16 bits of its sequence
+		full := len(frame) != PacketSize
+		for _, packet := range packets {
+			if !full {
+				packet.Sequence = glove.seq.extend(uint16(packet.Sequence))
+			}
+			glove.seq.observe(packet.Sequence, full, now) // No resend: gaps stay lost
+		}
+		glove.seq.expire(now)
+		glove.PacketLoss = glove.seq.lossPercent()
+	}
+	clock := glove.clock
+	s.broadcastMu.Unlock()
+
+	if err != nil {
+		log.Printf("Scanner: Failed to parse broadcast from %s: %v", id, err)
+		return
+	}
+
+	// Place everything on the server timeline
+	hostUs := now.UnixMicro()
+	if record != nil {
+		clock.ObserveArrival(record.Timestamp, hostUs)
+		record.Time = clock.ToServer(record.Timestamp)
+		record.Received = hostUs
+		if onPunch != nil {
+			onPunch(id, record)
+		}
+		return
+	}
+	if len(packets) > 0 {
+		clock.ObserveArrival(packets[len(packets)-1].Timestamp, hostUs)
+	}
+	for _, packet := range packets {
+		packet.Time = clock.ToServer(packet.Timestamp)
+		packet.Received = hostUs
+		if onPacket != nil {
+			onPacket(id, packet)
+		}
+	}
+}
+
+// Hearing reports whether a broadcasting glove was heard within
+// BroadcastTimeout.
+func (s *Scanner) Hearing(id GloveID) bool {
+	s.broadcastMu.Lock()
+	defer s.broadcastMu.Unlock()
+	glove := s.gloves[id]
+	return glove != nil && time.Since(glove.LastSeen) <= BroadcastTimeout
+}
+
+// BroadcastGloves returns every broadcasting glove heard so far, by athlete
+// and hand.
+func (s *Scanner) BroadcastGloves() []BroadcastGlove {
+	s.broadcastMu.Lock()
+	defer s.broadcastMu.Unlock()
+	gloves := make([]BroadcastGlove, 0, len(s.gloves))
+	for _, glove := range s.gloves {
+		gloves = append(gloves, *glove)
+	}
+	sort.Slice(gloves, func(i, j int) bool {
+		if gloves[i].ID.Athlete != gloves[j].ID.Athlete {
+			return gloves[i].ID.Athlete < gloves[j].ID.Athlete
+		}
+		return gloves[i].ID.Hand < gloves[j].ID.Hand
+	})
+	return gloves
+}
@@ -0,0 +1,153 @@
+package ble
+
+import "time"
+
+// Loss recovery (see firmware/lib/FighterLink/src/resend_buffer.h).
+const (
+	ResendTimeout    = time.Second // Gaps not refilled by then count as lost
+	resendMaxGaps    = 32          // Outstanding gaps per glove
+	resendMaxSamples = 4096        // Longer gaps are beyond the glove's buffer
+)
+
+// seqRange is the sample sequence range [first, end).
+type seqRange struct {
+	first, end uint32
+	asked      time.Time
+}
+
+func (r seqRange) contains(seq uint32) bool {
+	return int32(seq-r.first) >= 0 && int32(r.end-seq) > 0
+}
+
+// sequenceTracker follows one glove's sample sequence over a connection:
+// it extends the 16-bit sequence of single packets, finds gaps in the live
+// stream and decides which samples arriving late on the bulk
+// characteristic are still missing. Sequences compare modulo 2^32.
+type sequenceTracker struct {
+	started  bool
+	anchored bool   // A full 32-bit sequence has been seen
+	first    uint32 // First live sample of the connection
+	next     uint32 // Next live sample expected
+	gaps     []seqRange
+	received uint64 // Live plus recovered samples
+	lost     uint64 // Gaps given up on
+}
+
+// extend maps the low 16 bits of a single packet's sequence onto the full
+// sequence nearest the next expected sample.
+func (t *sequenceTracker) extend(low uint16) uint32 {
+	if !t.started {
+		return uint32(low)
+	}
+	return t.next + uint32(int32(int16(low-uint16(t.next))))
+}
+
+// rebase shifts everything tracked so far by shift.
+func (t *sequenceTracker) rebase(shift uint32) {
+	t.first += shift
+	t.next += shift
+	for i := range t.gaps {
+		t.gaps[i].first += shift
+		t.gaps[i].end += shift
+	}
+}
+
+// observe records a live sample (full: from a batch, not extended) and
+// returns the gap just before it, if any, for the caller to ask the glove
+// to resend.
+func (t *sequenceTracker) observe(seq uint32, full bool, now time.Time) (seqRange, bool) {
+	if full && !t.anchored {
+		// Single packets before the first batch were extended from 16 bits
+		// and are off by a multiple of 2^16
+		if t.started {
+			t.rebase((seq - t.next + 0x8000) &^ 0xFFFF)
+		}
+		t.anchored = true
+	}
+	if !t.started {
+		t.started = true
+		t.first = seq
+		t.next = seq + 1
+		t.received++
+		return seqRange{}, false
+	}
+	missed := int32(seq - t.next)
+	if missed < 0 {
+		return seqRange{}, false // Repeat of a sample already seen
+	}
+	t.received++
+	gap := seqRange{first: t.next, end: seq, asked: now}
+	t.next = seq + 1
+	if missed == 0 {
+		return seqRange{}, false
+	}
+	if missed > resendMaxSamples {
+		t.lost += uint64(missed)
+		return seqRange{}, false
+	}
+	// claim's splits can leave more than resendMaxGaps outstanding
+	for len(t.gaps) >= resendMaxGaps {
+		t.lost += uint64(t.gaps[0].end - t.gaps[0].first)
+		t.gaps = t.gaps[1:]
+	}
+	t.gaps = append(t.gaps, gap)
+	return gap, true
+}
+
+// predates reports whether a sample was taken before the connection's live
+// stream began (the glove logged it while disconnected).
+func (t *sequenceTracker) predates(seq uint32) bool {
+	return !t.started || int32(seq-t.first) < 0
+}
+
+// claim reports whether a sample that arrived late should be delivered:
+// it either fills a gap (once) or predates the connection.
+func (t *sequenceTracker) claim(seq uint32) bool {
+	if t.predates(seq) {
+		return true
+	}
+	for i, g := range t.gaps {
+		if !g.contains(seq) {
+			continue
+		}
+		switch {
+		case seq == g.first:
+			t.gaps[i].first++
+		case seq == g.end-1:
+			t.gaps[i].end--
+		default:
+			// Split around the sample
+			rest := seqRange{first: seq + 1, end: g.end, asked: g.asked}
+			t.gaps[i].end = seq
+			t.gaps = append(t.gaps[:i+1], append([]seqRange{rest}, t.gaps[i+1:]...)...)
+		}
+		if t.gaps[i].first == t.gaps[i].end {
+			t.gaps = append(t.gaps[:i], t.gaps[i+1:]...)
+		}
+		t.received++
+		return true
+	}
+	return false
+}
+
+// expire gives up on gaps the glove has not refilled within ResendTimeout.
+func (t *sequenceTracker) expire(now time.Time) {
+	kept := t.gaps[:0]
+	for _, g := range t.gaps {
+		if now.Sub(g.asked) > ResendTimeout {
+			t.lost += uint64(g.end - g.first)
+		} else {
+			kept = append(kept, g)
+		}
+	}
+	t.gaps = kept
+}
+
+// lossPercent is the share of samples that never arrived, live or resent.
+func (t *sequenceTracker) lossPercent() float64 {
+	total := t.received + t.lost
+	if total == 0 {
+		return 0
+	}
+	return float64(t.lost) / float64(total) * 100
+}
@@ -0,0 +1,205 @@
+package ble
+
+import (
+	"testing"
+	"time"
+)
+
+func checkGaps(t *testing.T, tr *sequenceTracker, want ...seqRange) {
+	t.Helper()
+	if len(tr.gaps) != len(want) {
+		t.Fatalf("gaps %v, want %v", tr.gaps, want)
+	}
+	for i, g := range tr.gaps {
+		if g.first != want[i].first || g.end != want[i].end {
+			t.Fatalf("gaps %v, want %v", tr.gaps, want)
+		}
+	}
+}
+
+func TestSequenceExtendWrap(t *testing.T) {
+	var tr sequenceTracker
+	now := time.Now()
+	for _, low := range []uint16{65534, 65535, 0, 1} {
+		seq := tr.extend(low)
+		tr.observe(seq, false, now)
+	}
+	if tr.next != 65538 {
+		t.Errorf("next %d, want 65538", tr.next)
+	}
+	// Nearest the next expected sample, either side of it
+	if seq := tr.extend(0x7FFF); seq != 0x17FFF {
+		t.Errorf("extend(0x7FFF) = 0x%x, want 0x17FFF", seq)
+	}
+	if seq := tr.extend(65530); seq != 65530 {
+		t.Errorf("extend(65530) = %d, want 65530", seq)
+	}
+
+	// Past 2^32
+	tr = sequenceTracker{}
+	tr.observe(0xFFFFFFFF, true, now)
+	if seq := tr.extend(1); seq != 1 {
+		t.Errorf("extend(1) after 0xFFFFFFFF = %d, want 1", seq)
+	}
+	if gap, ok := tr.observe(2, true, now); !ok || gap.first != 0 || gap.end != 2 {
+		t.Errorf("gap %v %v, want [0, 2)", gap, ok)
+	}
+}
+
+func TestSequenceRebase(t *testing.T) {
+	var tr sequenceTracker
+	now := time.Now()
+
+	// The glove is at 0x30005 but only single packets have arrived so far
+	tr.observe(tr.extend(5), false, now)
+	if _, ok := tr.observe(tr.extend(8), false, now); !ok {
+		t.Fatal("no gap before 8")
+	}
+	checkGaps(t, &tr, seqRange{first: 6, end: 8})
+
+	// The first batch anchors the sequence and moves everything by 3 × 2^16
+	if _, ok := tr.observe(0x30009, true, now); ok {
+		t.Error("gap at the anchoring batch")
+	}
+	if tr.first != 0x30005 || tr.next != 0x3000A {
+		t.Errorf("first 0x%x next 0x%x, want 0x30005 0x3000A", tr.first, tr.next)
+	}
+	checkGaps(t, &tr, seqRange{first: 0x30006, end: 0x30008})
+	if !tr.claim(0x30007) {
+		t.Error("claim(0x30007) after rebase")
+	}
+
+	// Anchored: later batches do not rebase
+	tr.observe(0x3000A, true, now)
+	if tr.next != 0x3000B {
+		t.Errorf("next 0x%x, want 0x3000B", tr.next)
+	}
+
+	// A gap before the anchoring batch is measured after the rebase
+	tr = sequenceTracker{}
+	tr.observe(tr.extend(0xFFFE), false, now)
+	if gap, ok := tr.observe(0x20003, true, now); !ok || gap.first != 0x1FFFF || gap.end != 0x20003 {
+		t.Errorf("gap %v %v, want [0x1FFFF, 0x20003)", gap, ok)
+	}
+}
+
+func TestSequenceObserve(t *testing.T) {
+	var tr sequenceTracker
+	now := time.Now()
+	tr.observe(100, true, now)
+
+	if _, ok := tr.observe(100, true, now); ok || tr.received != 1 {
+		t.Errorf("repeat: gap %v, received %d", ok, tr.received)
+	}
+	gap, ok := tr.observe(110, true, now)
+	if !ok || gap.first != 101 || gap.end != 110 || !gap.asked.Equal(now) {
+		t.Errorf("gap %v %v, want [101, 110)", gap, ok)
+	}
+
+	// Longer than the glove can resend: lost at once
+	if _, ok := tr.observe(111+resendMaxSamples+1, true, now); ok {
+		t.Error("resend asked beyond the glove's buffer")
+	}
+	if tr.lost != resendMaxSamples+1 {
+		t.Errorf("lost %d, want %d", tr.lost, resendMaxSamples+1)
+	}
+	checkGaps(t, &tr, seqRange{first: 101, end: 110})
+}
+
+func TestSequenceClaim(t *testing.T) {
+	var tr sequenceTracker
+	now := time.Now()
+	tr.observe(100, true, now)
+	tr.observe(110, true, now)
+
+	// Split around the sample; each is delivered once
+	if !tr.claim(105) {
+		t.Fatal("claim(105)")
+	}
+	checkGaps(t, &tr, seqRange{first: 101, end: 105}, seqRange{first: 106, end: 110})
+	if tr.claim(105) {
+		t.Error("claim(105) twice")
+	}
+	if !tr.claim(101) || !tr.claim(109) {
+		t.Fatal("claim at an edge")
+	}
+	checkGaps(t, &tr, seqRange{first: 102, end: 105}, seqRange{first: 106, end: 109})
+	for _, seq := range []uint32{106, 107, 108} {
+		tr.claim(seq)
+	}
+	checkGaps(t, &tr, seqRange{first: 102, end: 105})
+
+	// Live samples are not in a gap
+	if tr.claim(100) || tr.claim(110) || tr.claim(111) {
+		t.Error("claimed a live sample")
+	}
+	// Logged while disconnected
+	if !tr.claim(50) || !tr.predates(99) || tr.predates(100) {
+		t.Error("predating sample")
+	}
+	if tr.received != 2+6 {
+		t.Errorf("received %d, want 8", tr.received)
+	}
+}
+
+func TestSequenceMaxGaps(t *testing.T) {
+	var tr sequenceTracker
+	now := time.Now()
+	seq := uint32(0)
+	tr.observe(seq, true, now)
+	for i := 0; i < resendMaxGaps; i++ {
+		seq += 4
+		tr.observe(seq, true, now) // Gap of 3
+	}
+	if len(tr.gaps) != resendMaxGaps || tr.lost != 0 {
+		t.Fatalf("%d gaps, lost %d", len(tr.gaps), tr.lost)
+	}
+
+	// The oldest gap goes first
+	seq += 4
+	tr.observe(seq, true, now)
+	if len(tr.gaps) != resendMaxGaps || tr.lost != 3 || tr.gaps[0].first != 5 {
+		t.Fatalf("%d gaps, lost %d, oldest %v", len(tr.gaps), tr.lost, tr.gaps[0])
+	}
+
+	// Splits push past the limit; the next gap trims back under it
+	for _, g := range append([]seqRange(nil), tr.gaps[:3]...) {
+		tr.claim(g.first + 1)
+	}
+	if len(tr.gaps) != resendMaxGaps+3 {
+		t.Fatalf("%d gaps after splits", len(tr.gaps))
+	}
+	seq += 4
+	tr.observe(seq, true, now)
+	if len(tr.gaps) != resendMaxGaps {
+		t.Errorf("%d gaps, want %d", len(tr.gaps), resendMaxGaps)
+	}
+	if tr.lost != 3+4 {
+		t.Errorf("lost %d, want 7", tr.lost)
+	}
+}
+
+func TestSequenceExpire(t *testing.T) {
+	var tr sequenceTracker
+	start := time.Now()
+	tr.observe(0, true, start)
+	tr.observe(5, true, start)
+	tr.observe(10, true, start.Add(ResendTimeout/2))
+
+	tr.expire(start.Add(ResendTimeout))
+	checkGaps(t, &tr, seqRange{first: 1, end: 5}, seqRange{first: 6, end: 10})
+
+	tr.expire(start.Add(ResendTimeout + time.Millisecond))
+	checkGaps(t, &tr, seqRange{first: 6, end: 10})
+	if tr.lost != 4 {
+		t.Errorf("lost %d, want 4", tr.lost)
+	}
+	if tr.claim(3) {
+		t.Error("claimed an expired gap")
+	}
+
+	// 3 live, 4 lost
+	if got := tr.lossPercent(); got < 57.1 || got > 57.2 {
+		t.Errorf("loss %.2f%%, want 57.14%%", got)
+	}
+}
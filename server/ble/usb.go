@@ -0,0 +1,395 @@
+package ble
+
+import (
+	"bufio"
+	"encoding/binary"
+	"fmt"
+	"io"
+	"log"
+	"sort"
+	"sync"
+	"time"
+)
+
+// ─── USB Transport ───────────────────────────────────────────────────────────
+
+// Framing of a glove built with USB_TRANSPORT_ENABLED (see UsbFrameHeader in
+// firmware/lib/FighterLink/src/sensor_packet.h): sync, hand, length, the
+// frame the glove would have notified, then a CRC-16/CCITT-FALSE over hand,
+// length and frame. The glove's status text runs between frames.
+const (
+	USBFrameSync0      byte = 0xFE
+	USBFrameSync1      byte = 0x4C
+	USBFrameMaxPayload      = 244 // BATCH_MAX_PAYLOAD
+	usbFrameHeaderSize      = 5
+	usbFrameCRCSize         = 2
+)
+
+// USBTimeout is how long a glove on an open port may send nothing before
+// it no longer counts as connected.
+const USBTimeout = 3 * time.Second
+
+// USBReopenDelay is how long the receiver waits before opening a port
+// again after it failed or went away (the glove rebooted or was unplugged).
+const USBReopenDelay = 2 * time.Second
+
+// usbFrameCRC computes CRC-16/CCITT-FALSE.
+func usbFrameCRC(data []byte) uint16 {
+	crc := uint16(0xFFFF)
+	for _, b := range data {
+		crc ^= uint16(b) << 8
+		for bit := 0; bit < 8; bit++ {
+			if crc&0x8000 != 0 {
+				crc = crc<<1 ^ 0x1021
+			} else {
+				crc <<= 1
+			}
+		}
+	}
+	return crc
+}
+
+// USBFrame wraps a control-characteristic value for writing to a glove's
+// port.
+func USBFrame(value []byte) []byte {
+	frame := make([]byte, usbFrameHeaderSize, usbFrameHeaderSize+len(value)+usbFrameCRCSize)
+	frame[0], frame[1] = USBFrameSync0, USBFrameSync1
+	binary.LittleEndian.PutUint16(frame[3:5], uint16(len(value)))
+	frame = append(frame, value...)
+	return binary.LittleEndian.AppendUint16(frame, usbFrameCRC(frame[2:]))
+}
+
+// usbDeframer picks frames out of a glove's byte stream and passes the
+// status text between them on line by line.
+type usbDeframer struct {
+	r        *bufio.Reader
+	line     []byte
+	onLine   func(line string)
+	rejected uint64 // Frames dropped for a bad length or CRC
+}
+
+// next returns the next intact frame and the hand it came from.
+func (d *usbDeframer) next() (Hand, []byte, error) {
+	for {
+		b, err := d.r.ReadByte()
+		if err != nil {
+			return 0, nil, err
+		}
+		if b != USBFrameSync0 {
+			d.text(b)
+			continue
+		}
+		// Peek the rest of the frame rather than reading it: on a bad
+		// length or CRC only the false sync byte is consumed and the
+		// search restarts from the byte after it.
+		header, err := d.r.Peek(usbFrameHeaderSize - 1)
+		if err != nil {
+			return 0, nil, err
+		}
+		if header[0] != USBFrameSync1 {
+			continue
+		}
+		length := int(binary.LittleEndian.Uint16(header[2:4]))
+		if length > USBFrameMaxPayload {
+			d.rejected++
+			continue
+		}
+		frame, err := d.r.Peek(usbFrameHeaderSize - 1 + length + usbFrameCRCSize)
+		if err != nil {
+			return 0, nil, err
+		}
+		end := usbFrameHeaderSize - 1 + length
+		if usbFrameCRC(frame[1:end]) != binary.LittleEndian.Uint16(frame[end:]) {
+			d.rejected++
+			continue
+		}
+		hand, payload := Hand(frame[1]), append([]byte(nil), frame[usbFrameHeaderSize-1:end]...)
+		d.r.Discard(len(frame))
+		return hand, payload, nil
+	}
+}
+
+func (d *usbDeframer) text(b byte) {
+	switch {
+	case b == '\n':
+		if len(d.line) > 0 && d.onLine != nil {
+			d.onLine(string(d.line))
+		}
+		d.line = d.line[:0]
+	case b == '\r':
+	case len(d.line) < 256:
+		d.line = append(d.line, b)
+	}
+}
+
+// USBGlove is what the receiver knows about the glove on one port.
+type USBGlove struct {
+	Port       string    `json:"port"`
+	Hand       Hand      `json:"hand"`
+	Open       bool      `json:"open"`
+	LastSeen   time.Time `json:"last_seen"`
+	Frames     uint64    `json:"frames"`      // Intact frames received
+	Rejected   uint64    `json:"rejected"`    // Frames dropped for a bad length or CRC
+	PacketLoss float64   `json:"packet_loss"` // Samples missing from the sequence, %
+
+	port               io.Writer
+	clock              *Clock
+	seq                sequenceTracker
+	lastPunchCount     uint16
+	lastFrameTimestamp uint32
+	lastFrameReceived  int64
+}
+
+// USBReceiver takes the stream of gloves plugged into the server over USB,
+// one port per glove, and hands it to the same packet, punch and latency
+// handlers as the Central. Every frame arrives, so there is no resend and
+// gaps only mean the glove had to drop them; there is no clock sync either,
+// samples are placed by arrival (a USB frame's delay is a millisecond or
+// two and steady).
+type USBReceiver struct {
+	mu        sync.Mutex
+	gloves    map[string]*USBGlove
+	config    *StreamConfig
+	onPacket  PacketHandler
+	onPunch   PunchHandler
+	onLatency LatencyHandler
+}
+
+// NewUSBReceiver creates a receiver with no ports open.
+func NewUSBReceiver() *USBReceiver {
+	return &USBReceiver{gloves: make(map[string]*USBGlove)}
+}
+
+// SetPacketHandler sets the callback for every sample.
+func (r *USBReceiver) SetPacketHandler(handler PacketHandler) {
+	r.mu.Lock()
+	r.onPacket = handler
+	r.mu.Unlock()
+}
+
+// SetPunchHandler sets the callback for punch events and heartbeats.
+func (r *USBReceiver) SetPunchHandler(handler PunchHandler) {
+	r.mu.Lock()
+	r.onPunch = handler
+	r.mu.Unlock()
+}
+
+// SetLatencyHandler sets the callback for traced frames.
+func (r *USBReceiver) SetLatencyHandler(handler LatencyHandler) {
+	r.mu.Lock()
+	r.onLatency = handler
+	r.mu.Unlock()
+}
+
+// SetStreamConfig asks every glove, now and as ports open, to stream config.
+func (r *USBReceiver) SetStreamConfig(config StreamConfig) {
+	r.mu.Lock()
+	r.config = &config
+	gloves := make([]*USBGlove, 0, len(r.gloves))
+	for _, glove := range r.gloves {
+		if glove.Open {
+			gloves = append(gloves, glove)
+		}
+	}
+	r.mu.Unlock()
+
+	for _, glove := range gloves {
+		r.configure(glove, &config)
+	}
+}
+
+// configure writes the stream configuration (if any) and a latency trace
+// request. Without a configuration the glove streams its boot defaults,
+// events unless its config.h says otherwise.
+func (r *USBReceiver) configure(glove *USBGlove, config *StreamConfig) {
+	every := uint8(LatencyTraceEvery)
+	if config != nil {
+		if _, err := glove.port.Write(USBFrame(config.Commands())); err != nil {
+			log.Printf("USB: stream config write to %s failed: %v", glove.Port, err)
+			return
+		}
+		log.Printf("USB: %s streaming %s", glove.Port, config)
+	}
+	if config == nil || config.Mode == StreamModeEvents {
+		every = 1
+	}
+	if _, err := glove.port.Write(USBFrame(LatencyCommand(every))); err != nil {
+		log.Printf("USB: latency trace request to %s failed: %v", glove.Port, err)
+	}
+}
+
+// Open starts reading the glove on port (e.g. /dev/ttyACM0) and keeps
+// reopening it whenever it goes away.
+func (r *USBReceiver) Open(port string) {
+	go func() {
+		var lastErr string
+		for {
+			err := r.stream(port)
+			if err.Error() != lastErr {
+				log.Printf("USB: %s: %v, retrying every %s", port, err, USBReopenDelay)
+				lastErr = err.Error()
+			}
+			time.Sleep(USBReopenDelay)
+		}
+	}()
+}
+
+// stream reads one glove until its port fails.
+func (r *USBReceiver) stream(path string) error {
+	port, err := openSerialPort(path)
+	if err != nil {
+		return err
+	}
+	defer port.Close()
+
+	glove := &USBGlove{Port: path, Open: true, port: port, clock: NewClock(time.Microsecond)}
+	r.mu.Lock()
+	r.gloves[path] = glove
+	config := r.config
+	r.mu.Unlock()
+	defer func() {
+		r.mu.Lock()
+		glove.Open = false
+		r.mu.Unlock()
+	}()
+
+	log.Printf("USB: Opened %s", path)
+	r.configure(glove, config)
+
+	deframer := &usbDeframer{
+		r: bufio.NewReaderSize(port, 4096),
+		onLine: func(line string) {
+			log.Printf("USB %s: %s", path, line)
+		},
+	}
+	for {
+		hand, frame, err := deframer.next()
+		if err != nil {
+			return fmt.Errorf("read failed: %w", err)
+		}
+		r.handleFrame(glove, hand, frame, deframer.rejected)
+	}
+}
+
+// handleFrame processes one frame from a glove's port.
+func (r *USBReceiver) handleFrame(glove *USBGlove, hand Hand, frame []byte, rejected uint64) {
+	now := time.Now()
+	received := now.UnixMicro()
+
+	r.mu.Lock()
+	if glove.Frames == 0 || glove.Hand != hand {
+		log.Printf("USB: %s glove on %s", hand, glove.Port)
+	}
+	glove.Hand = hand
+	glove.LastSeen = now
+	glove.Frames++
+	glove.Rejected = rejected
+	onPacket, onPunch, onLatency := r.onPacket, r.onPunch, r.onLatency
+
+	// Traces follow the frame they describe
+	if IsLatencyFrame(frame) {
+		captured, queued, err := ParseLatencyFrame(frame)
+		if err != nil || glove.lastFrameReceived == 0 || glove.lastFrameTimestamp != captured {
+			r.mu.Unlock()
+			return
+		}
+		trace := &LatencyTrace{
+			Captured: glove.clock.ToServer(captured),
+			Queued:   glove.clock.ToServer(queued),
+			Received: glove.lastFrameReceived,
+		}
+		r.mu.Unlock()
+		if onLatency != nil {
+			onLatency(hand, trace)
+		}
+		return
+	}
+
+	var packets []*SensorPacket
+	var record *PunchRecord
+	var err error
+	if IsPunchFrame(frame) {
+		record, err = ParsePunchRecord(frame)
+		if err == nil {
+			// Heartbeats repeat the latest count, punches advance it by one
+			expected := glove.lastPunchCount
+			if !record.IsHeartbeat() {
+				expected++
+			}
+			if glove.lastPunchCount > 0 && record.Count > expected {
+				log.Printf("USB: %s lost %d punch event(s)", glove.Port, record.Count-expected)
+			}
+			glove.lastPunchCount = record.Count
+			glove.lastFrameTimestamp = record.Timestamp
+			glove.lastFrameReceived = received
+		}
+	} else if packets, err = ParseFrame(frame); err == nil {
+		// A 20-byte packet only carries the low 16 bits of its sequence
+		full := len(frame) != PacketSize
+		for _, packet := range packets {
+			if !full {
+				packet.Sequence = glove.seq.extend(uint16(packet.Sequence))
+			}
+			glove.seq.observe(packet.Sequence, full, now) // Dropped on the glove: stays lost
+		}
+		glove.seq.expire(now)
+		glove.PacketLoss = glove.seq.lossPercent()
+		if len(packets) > 0 {
+			glove.lastFrameTimestamp = packets[0].Timestamp
+			glove.lastFrameReceived = received
+		}
+	}
+	clock := glove.clock
+	r.mu.Unlock()
+
+	if err != nil {
+		log.Printf("USB: Failed to parse frame from %s: %v", glove.Port, err)
+		return
+	}
+
+	// Place everything on the server timeline
+	if record != nil {
+		clock.ObserveArrival(record.Timestamp, received)
+		record.Time = clock.ToServer(record.Timestamp)
+		record.Received = received
+		if onPunch != nil {
+			onPunch(hand, record)
+		}
+		return
+	}
+	if len(packets) > 0 {
+		clock.ObserveArrival(packets[len(packets)-1].Timestamp, received)
+	}
+	for _, packet := range packets {
+		packet.Time = clock.ToServer(packet.Timestamp)
+		packet.Received = received
+		if onPacket != nil {
+			onPacket(hand, packet)
+		}
+	}
+}
+
+// Receiving reports whether a glove for hand sent anything on an open port
+// within USBTimeout.
+func (r *USBReceiver) Receiving(hand Hand) bool {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	for _, glove := range r.gloves {
+		if glove.Open && glove.Frames > 0 && glove.Hand == hand && time.Since(glove.LastSeen) <= USBTimeout {
+			return true
+		}
+	}
+	return false
+}
+
+// Gloves returns every port opened so far and the glove last seen on it.
+func (r *USBReceiver) Gloves() []USBGlove {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	gloves := make([]USBGlove, 0, len(r.gloves))
+	for _, glove := range r.gloves {
+		gloves = append(gloves, *glove)
+	}
+	sort.Slice(gloves, func(i, j int) bool { return gloves[i].Port < gloves[j].Port })
+	return gloves
+}
@@ -0,0 +1,11 @@
+//go:build !linux
+
+package ble
+
+import "os"
+
+// openSerialPort opens the port as it is configured; put it in raw mode
+// first (stty -f <port> raw on macOS).
+func openSerialPort(path string) (*os.File, error) {
+	return os.OpenFile(path, os.O_RDWR, 0)
+}
@@ -0,0 +1,81 @@
+package ble
+
+import (
+	"bufio"
+	"bytes"
+	"encoding/binary"
+	"errors"
+	"io"
+	"strings"
+	"testing"
+)
+
+// usbTestFrame frames value as the glove does (usbFrameEncode), for hand.
+func usbTestFrame(hand Hand, value []byte) []byte {
+	frame := USBFrame(value)
+	frame[2] = byte(hand)
+	binary.LittleEndian.PutUint16(frame[len(frame)-usbFrameCRCSize:], usbFrameCRC(frame[2:len(frame)-usbFrameCRCSize]))
+	return frame
+}
+
+func TestUSBDeframerResync(t *testing.T) {
+	payload := []byte{FrameTypeBatch, 0x01, 0x02}
+	good := usbTestFrame(RightHand, payload)
+	badCRC := append([]byte(nil), good...)
+	badCRC[len(badCRC)-1] ^= 0xFF
+
+	var stream []byte
+	stream = append(stream, "Boot\n"...)
+	// A false sync whose length covers the good frame right after it
+	stream = append(stream, USBFrameSync0, USBFrameSync1, 0, 12, 0)
+	stream = append(stream, good...)
+	stream = append(stream, "Status\n"...)
+	stream = append(stream, USBFrameSync0, USBFrameSync1, 0, 0xFF, 0xFF) // Beyond USBFrameMaxPayload
+	stream = append(stream, good...)
+	stream = append(stream, badCRC...)
+	stream = append(stream, good...)
+
+	var lines []string
+	d := &usbDeframer{
+		r:      bufio.NewReader(bytes.NewReader(stream)),
+		onLine: func(line string) { lines = append(lines, line) },
+	}
+	for i := 0; i < 3; i++ {
+		hand, frame, err := d.next()
+		if err != nil {
+			t.Fatalf("frame %d: %v", i, err)
+		}
+		if hand != RightHand || !bytes.Equal(frame, payload) {
+			t.Errorf("frame %d: hand %d % x, want %d % x", i, hand, frame, RightHand, payload)
+		}
+	}
+	if _, _, err := d.next(); !errors.Is(err, io.EOF) {
+		t.Errorf("after the last frame: err %v, want EOF", err)
+	}
+	if d.rejected != 3 {
+		t.Errorf("rejected %d, want 3", d.rejected)
+	}
+
+	// The false sync's header bytes fall back to the text they came in
+	if len(lines) != 2 || lines[0] != "Boot" || !strings.HasSuffix(lines[1], "Status") {
+		t.Errorf("lines %q, want Boot and Status", lines)
+	}
+}
+
+func TestUSBDeframerPayloadCopy(t *testing.T) {
+	first := usbTestFrame(LeftHand, []byte{1, 2, 3})
+	second := usbTestFrame(LeftHand, []byte{4, 5, 6})
+	d := &usbDeframer{r: bufio.NewReaderSize(bytes.NewReader(append(first, second...)), 16)}
+
+	_, a, err := d.next()
+	if err != nil {
+		t.Fatal(err)
+	}
+	if _, _, err := d.next(); err != nil {
+		t.Fatal(err)
+	}
+	// Still the first frame once the reader's buffer has moved on
+	if !bytes.Equal(a, []byte{1, 2, 3}) {
+		t.Errorf("first payload % x after reading the second", a)
+	}
+}
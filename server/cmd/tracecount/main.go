@@ -0,0 +1,30 @@
+// Command tracecount replays sample traces through the server's punch
+// analyzer and prints each trace's punch count, in the format the
+// firmware's native replay bench expects for its regression check:
+//
+//	go run ./cmd/tracecount ../firmware/bench/traces/*.csv > ../firmware/bench/traces/expected.txt
+package main
+
+import (
+	"fmt"
+	"log"
+	"os"
+	"path/filepath"
+
+	"boxing-analytics/analytics"
+)
+
+func main() {
+	if len(os.Args) < 2 {
+		fmt.Fprintln(os.Stderr, "usage: tracecount trace.csv...")
+		os.Exit(2)
+	}
+
+	for _, path := range os.Args[1:] {
+		packets, err := analytics.ReadTrace(path)
+		if err != nil {
+			log.Fatal(err)
+		}
+		fmt.Printf("%s %d\n", filepath.Base(path), analytics.ReplayTrace(packets))
+	}
+}
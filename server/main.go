@@ -6,6 +6,7 @@
 //
 // Responsibilities:
 //   - BLE Central: Connect to dual gloves, receive 100Hz sensor data
+//   - USB: Lab capture from gloves plugged in over native USB (USB_PORTS)
 //   - Analytics: Punch detection, classification (straight/hook/uppercut)
 //   - WebSocket: Broadcast SessionState to React dashboard
 //   - HTTP: Serve embedded React build + REST session API
@@ -23,6 +24,7 @@ import (
 	"net"
 	"net/http"
 	"os"
+	"strconv"
 	"strings"
 	"sync"
 	"time"
@@ -49,7 +51,14 @@ const (
 
 type wsClient struct {
 	conn net.Conn
-	send chan []byte
+	send chan wsMessage
+}
+
+// wsMessage is one frame queued for a client. onSent, if set, runs after
+// the frame was written, with the time in µs.
+type wsMessage struct {
+	frame  []byte
+	onSent func(sentUs int64)
 }
 
 type Hub struct {
@@ -77,13 +86,21 @@ func (h *Hub) unregister(c *wsClient) {
 	h.mu.Unlock()
 }
 
-func (h *Hub) Broadcast(payload []byte) {
-	frame := makeWsTextFrame(payload)
+// Broadcast queues payload for every client. onSent (may be nil) runs once,
+// when the first client's write of it succeeds; never if none does.
+func (h *Hub) Broadcast(payload []byte, onSent func(sentUs int64)) {
+	msg := wsMessage{frame: makeWsTextFrame(payload)}
+	if onSent != nil {
+		var once sync.Once
+		msg.onSent = func(sentUs int64) {
+			once.Do(func() { onSent(sentUs) })
+		}
+	}
 	h.mu.Lock()
 	defer h.mu.Unlock()
 	for c := range h.clients {
 		select {
-		case c.send <- frame:
+		case c.send <- msg:
 		default:
 			// Slow client — drop frame
 		}
@@ -154,14 +171,14 @@ func wsHandler(hub *Hub, analyzer *analytics.Analyzer) http.HandlerFunc {
 			return
 		}
 
-		client := &wsClient{conn: conn, send: make(chan []byte, 64)}
+		client := &wsClient{conn: conn, send: make(chan wsMessage, 64)}
 		hub.register(client)
 		log.Printf("WS client connected: %s", conn.RemoteAddr())
 
 		// Send current state immediately
 		state := analyzer.GetState()
 		if data, err := json.Marshal(state); err == nil {
-			client.send <- makeWsTextFrame(data)
+			client.send <- wsMessage{frame: makeWsTextFrame(data)}
 		}
 
 		// Write pump
@@ -170,10 +187,13 @@ func wsHandler(hub *Hub, analyzer *analytics.Analyzer) http.HandlerFunc {
 				conn.Close()
 				log.Printf("WS client disconnected: %s", conn.RemoteAddr())
 			}()
-			for frame := range client.send {
-				if _, err := conn.Write(frame); err != nil {
+			for msg := range client.send {
+				if _, err := conn.Write(msg.frame); err != nil {
 					return
 				}
+				if msg.onSent != nil {
+					msg.onSent(time.Now().UnixMicro())
+				}
 			}
 		}()
 
@@ -289,12 +309,81 @@ func recalibrateHandler(analyzer *analytics.Analyzer) http.HandlerFunc {
 	}
 }
 
-func statusHandler(central *ble.Central) http.HandlerFunc {
+// streamHandler switches how the gloves stream for the session:
+// POST /api/stream?preset=events|analysis|fusion|sparring
+func streamHandler(central *ble.Central, usb *ble.USBReceiver) http.HandlerFunc {
+	return func(w http.ResponseWriter, r *http.Request) {
+		if r.Method != http.MethodPost {
+			http.Error(w, "POST only", http.StatusMethodNotAllowed)
+			return
+		}
+
+		preset := r.URL.Query().Get("preset")
+		config, ok := ble.StreamPresets[preset]
+		if !ok {
+			http.Error(w, "Invalid preset: must be 'events', 'analysis', 'fusion', or 'sparring'", http.StatusBadRequest)
+			return
+		}
+
+		central.SetStreamConfig(config)
+		if usb != nil {
+			usb.SetStreamConfig(config)
+		}
+		log.Printf("Stream preset %s: %s", preset, config)
+		w.Header().Set("Content-Type", "application/json")
+		w.Write([]byte(`{"ok":true}`))
+	}
+}
+
+func statusHandler(central *ble.Central, scanner *ble.Scanner, usb *ble.USBReceiver,
+	latency *analytics.LatencyTracker) http.HandlerFunc {
 	return func(w http.ResponseWriter, r *http.Request) {
 		status := map[string]interface{}{
 			"left_connected":  central.IsConnected(ble.LeftHand),
 			"right_connected": central.IsConnected(ble.RightHand),
 		}
+		if config, ok := central.StreamConfig(ble.LeftHand); ok {
+			status["left_stream"] = config.String()
+		}
+		if config, ok := central.StreamConfig(ble.RightHand); ok {
+			status["right_stream"] = config.String()
+		}
+		if link, err := central.LinkStatus(ble.LeftHand); err == nil {
+			status["left_link"] = link
+		}
+		if link, err := central.LinkStatus(ble.RightHand); err == nil {
+			status["right_link"] = link
+		}
+		// On-glove stalls and drops next to what was lost on the way in
+		if loss, ok := central.PacketLoss(ble.LeftHand); ok {
+			status["left_packet_loss"] = loss
+		}
+		if loss, ok := central.PacketLoss(ble.RightHand); ok {
+			status["right_packet_loss"] = loss
+		}
+		if diag, err := central.Diagnostics(ble.LeftHand); err == nil {
+			status["left_diag"] = diag
+		}
+		if diag, err := central.Diagnostics(ble.RightHand); err == nil {
+			status["right_diag"] = diag
+		}
+		if clock, ok := central.ClockStatus(ble.LeftHand); ok {
+			status["left_clock"] = clock
+		}
+		if clock, ok := central.ClockStatus(ble.RightHand); ok {
+			status["right_clock"] = clock
+		}
+		// Every broadcasting glove in range, not just the dashboard's athlete
+		if gloves := scanner.BroadcastGloves(); len(gloves) > 0 {
+			status["broadcast"] = gloves
+		}
+		if usb != nil {
+			status["usb"] = usb.Gloves()
+		}
+		// Impact to dashboard, stage by stage
+		if stages := latency.Stats(); len(stages) > 0 {
+			status["latency"] = stages
+		}
 		w.Header().Set("Content-Type", "application/json")
 		json.NewEncoder(w).Encode(status)
 	}
@@ -321,6 +410,39 @@ func main() {
 	hub := newHub()
 	analyzer := analytics.NewAnalyzer()
 	central := ble.NewCentral()
+	latency := analytics.NewLatencyTracker()
+
+	// Lab capture (USB_TRANSPORT_ENABLED firmware): USB_PORTS lists the
+	// gloves' ports and takes the place of BLE
+	var usb *ble.USBReceiver
+	var usbPorts []string
+	if ports := os.Getenv("USB_PORTS"); ports != "" {
+		usb = ble.NewUSBReceiver()
+		usbPorts = strings.Split(ports, ",")
+	}
+
+	// Optional per-session stream preset; gloves keep their defaults otherwise
+	if preset := os.Getenv("STREAM_PRESET"); preset != "" {
+		config, ok := ble.StreamPresets[preset]
+		if !ok {
+			log.Fatalf("Unknown STREAM_PRESET %q (events, analysis, fusion, sparring)", preset)
+		}
+		central.SetStreamConfig(config)
+		if usb != nil {
+			usb.SetStreamConfig(config)
+		}
+		log.Printf("Stream preset %s: %s", preset, config)
+	}
+
+	// Optional sample traces for the firmware's native replay bench
+	var traces *analytics.TraceRecorder
+	if dir := os.Getenv("TRACE_DIR"); dir != "" {
+		var err error
+		if traces, err = analytics.NewTraceRecorder(dir); err != nil {
+			log.Fatalf("TRACE_DIR: %v", err)
+		}
+		log.Printf("Recording sample traces to %s", dir)
+	}
 
 	// Set up state broadcast to WebSocket clients
 	analyzer.SetStateHandler(func(state *analytics.SessionState) {
@@ -329,29 +451,107 @@ func main() {
 			log.Printf("JSON marshal error: %v", err)
 			return
 		}
-		hub.Broadcast(data)
+		// A punch's dashboard stage ends when its state is on a client's socket
+		var onSent func(sentUs int64)
+		if state.Latency != nil {
+			punch := *state.Latency
+			onSent = func(sentUs int64) {
+				latency.ObservePunch(&punch, sentUs)
+			}
+		}
+		hub.Broadcast(data, onSent)
 	})
 
+	// Connectionless gloves (BROADCAST_ENABLED firmware): any number are
+	// heard at once and BROADCAST_ATHLETE picks whose drive the dashboard
+	broadcast := os.Getenv("BROADCAST") == "1"
+	var athlete uint8
+	if value := os.Getenv("BROADCAST_ATHLETE"); value != "" {
+		n, err := strconv.ParseUint(value, 10, 8)
+		if err != nil {
+			log.Fatalf("BROADCAST_ATHLETE: %v", err)
+		}
+		athlete = uint8(n)
+	}
+
 	// Set up packet handler from BLE
-	central.SetPacketHandler(func(hand ble.Hand, packet *ble.SensorPacket) {
+	onPacket := func(hand ble.Hand, packet *ble.SensorPacket) {
 		analyzer.ProcessPacket(hand, packet)
 
+		if traces != nil {
+			if err := traces.Record(hand, packet); err != nil {
+				log.Printf("Trace [%s]: %v", hand, err)
+			}
+		}
+
 		if debugBLE {
 			log.Printf("BLE [%s]: %s", hand, packet)
 		}
+	}
+	central.SetPacketHandler(onPacket)
+
+	// Samples a glove logged while its link was down, replayed on reconnect
+	central.SetBackfillHandler(func(hand ble.Hand, packet *ble.SensorPacket) {
+		analyzer.ProcessBackfillPacket(hand, packet)
 	})
 
-	// Initialize BLE adapter
-	if err := central.Enable(); err != nil {
-		log.Fatalf("Failed to enable BLE: %v", err)
+	// Set up punch handler for gloves running on-glove detection
+	onPunch := func(hand ble.Hand, record *ble.PunchRecord) {
+		analyzer.ProcessPunchRecord(hand, record)
+
+		if debugBLE && !record.IsHeartbeat() {
+			log.Printf("BLE [%s]: punch #%d type=%d force=%.2f m/s² rot=%.1f °/s ts=%d",
+				hand, record.Count, record.Type, record.ForceMS2(), record.RotationDPS(), record.Timestamp)
+		}
+	}
+	central.SetPunchHandler(onPunch)
+
+	// Traced frames' time on the glove and on air
+	onLatency := func(hand ble.Hand, trace *ble.LatencyTrace) {
+		latency.ObserveTrace(trace)
+	}
+	central.SetLatencyHandler(onLatency)
+
+	// Initialize BLE adapter (not needed for USB capture)
+	if usb == nil {
+		if err := central.Enable(); err != nil {
+			log.Fatalf("Failed to enable BLE: %v", err)
+		}
 	}
 
 	// Create scanner for auto-discovery
 	scanner := ble.NewScanner(central, ble.DefaultScanConfig())
 
 	// Start scanning for gloves
-	scanner.Start()
-	log.Println("Scanning for FighterLink_L and FighterLink_R...")
+	connected := central.IsConnected
+	if usb != nil {
+		// Same handlers as BLE: recordings and analytics see one pipeline
+		usb.SetPacketHandler(onPacket)
+		usb.SetPunchHandler(onPunch)
+		usb.SetLatencyHandler(onLatency)
+		for _, port := range usbPorts {
+			usb.Open(strings.TrimSpace(port))
+		}
+		connected = usb.Receiving
+		log.Printf("Reading gloves over USB on %s...", strings.Join(usbPorts, ", "))
+	} else if broadcast {
+		scanner.StartBroadcast(func(id ble.GloveID, packet *ble.SensorPacket) {
+			if id.Athlete == athlete {
+				onPacket(id.Hand, packet)
+			}
+		}, func(id ble.GloveID, record *ble.PunchRecord) {
+			if id.Athlete == athlete {
+				onPunch(id.Hand, record)
+			}
+		})
+		connected = func(hand ble.Hand) bool {
+			return scanner.Hearing(ble.GloveID{Athlete: athlete, Hand: hand})
+		}
+		log.Printf("Listening for broadcasting gloves (dashboard: athlete %d)...", athlete)
+	} else {
+		scanner.Start()
+		log.Println("Scanning for FighterLink_L and FighterLink_R...")
+	}
 
 	// Ticker: broadcast elapsed time and log sensor data every second
 	go func() {
@@ -363,10 +563,13 @@ func main() {
 
 		for range ticker.C {
 			analyzer.BroadcastTick()
+			if traces != nil {
+				traces.Flush()
+			}
 
 			// Update connection status in analyzer
-			analyzer.SetConnected(ble.LeftHand, central.IsConnected(ble.LeftHand))
-			analyzer.SetConnected(ble.RightHand, central.IsConnected(ble.RightHand))
+			analyzer.SetConnected(ble.LeftHand, connected(ble.LeftHand))
+			analyzer.SetConnected(ble.RightHand, connected(ble.RightHand))
 
 			// Get current state for logging
 			state := analyzer.GetState()
@@ -423,7 +626,8 @@ func main() {
 	mux.HandleFunc("/api/session/resume", sessionResumeHandler(analyzer))
 	mux.HandleFunc("/api/session/stop", sessionStopHandler(analyzer))
 	mux.HandleFunc("/api/recalibrate", recalibrateHandler(analyzer))
-	mux.HandleFunc("/api/status", statusHandler(central))
+	mux.HandleFunc("/api/status", statusHandler(central, scanner, usb, latency))
+	mux.HandleFunc("/api/stream", streamHandler(central, usb))
 
 	// Embedded React build
 	stripped, err := fs.Sub(staticFiles, "static")